@@ -16,7 +16,8 @@ enum AffineBackgroundID
 };
 
 void affine_background_init();
-IWRAM_CODE void affine_background_hblank();
+IWRAM_CODE void affine_background_vblank(); // Call at the start of VBLANK
+IWRAM_CODE void affine_background_hblank(); // Only used when built with AFFINE_BG_HBLANK_IRQ
 IWRAM_CODE void affine_background_update();
 void affine_background_set_color(COLOR color);
 // Must be called with an array of size at least  AFFINE_BG_PAL_LEN
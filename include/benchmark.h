@@ -0,0 +1,10 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+/* On-device benchmarks, built in with `make BENCHMARK=1`.
+ * Timing uses the tonc profiler (timers 2 and 3 cascaded, maxmod only uses timer 0)
+ * so results are in CPU cycles. The results are printed on screen instead of starting the game.
+ */
+void benchmark_run(void);
+
+#endif // BENCHMARK_H
@@ -5,10 +5,6 @@
 
 #define MAX_ANTE 8 // The GBA's max uint value is around 4 billion, so we're going to not add endless mode for simplicity's sake
 
-#define SMALL_BLIND_PB 1
-#define BIG_BLIND_PB 2
-#define BOSS_BLIND_PB 3
-
 #define BLIND_SPRITE_OFFSET 16
 #define BLIND_SPRITE_COPY_SIZE BLIND_SPRITE_OFFSET * 8 // 8 ints per tile
 #define SMALL_BLIND_TID 960
@@ -55,7 +51,7 @@ typedef struct
     const unsigned int* tiles;
     const u16* palette;
     u32 tid;
-    u32 pb;
+    int pb; // From pal_bank.c, UNDEFINED until the graphics are loaded
 } BlindGfxInfo;
 
 typedef struct
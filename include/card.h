@@ -11,7 +11,6 @@
 
 #define CARD_TID 0
 #define CARD_SPRITE_OFFSET 16
-#define CARD_PB 0
 #define CARD_STARTING_LAYER 0
 
 // Card suits
@@ -50,7 +49,8 @@ typedef struct Card
 typedef struct CardObject
 {
     Card *card;
-    SpriteObject *sprite_object;
+    SpriteObject sprite_object; // Inline so the motion state is in the same record as the card
+    int tile_index; // Tiles of the card face in the tile cache, UNDEFINED until the sprite is first set
 } CardObject;
 
 // Card functions
@@ -65,7 +65,9 @@ u8 card_get_value(Card *card);
 CardObject *card_object_new(Card *card);
 void card_object_destroy(CardObject **card_object);
 void card_object_update(CardObject *card_object); // Update the card object position and scale
-void card_object_set_sprite(CardObject *card_object, int layer);
+void card_object_set_sprite(CardObject *card_object, int layer); // Only touches OAM if the face is already cached
+uint card_get_tile_upload_bytes(); // Bytes of card tiles written to VRAM since the last reset
+void card_reset_tile_upload_bytes();
 void card_object_shake(CardObject* card_object, mm_word sound_id);
 
 void card_object_set_selected(CardObject* card_object, bool selected);
@@ -3,7 +3,6 @@
 #include "card.h"
 
 POOL_ENTRY(Sprite, MAX_SPRITES);
-POOL_ENTRY(SpriteObject, MAX_SPRITE_OBJECTS);
 POOL_ENTRY(Joker, MAX_ACTIVE_JOKERS);
 POOL_ENTRY(JokerObject, MAX_ACTIVE_JOKERS);
 POOL_ENTRY(Card, MAX_CARDS);
@@ -11,12 +11,4 @@ DEF_JOKER_GFX(9)
 DEF_JOKER_GFX(10)
 DEF_JOKER_GFX(11)
 DEF_JOKER_GFX(12)
-DEF_JOKER_GFX(13)
-DEF_JOKER_GFX(14)
-DEF_JOKER_GFX(15)
-DEF_JOKER_GFX(16)
-DEF_JOKER_GFX(17)
-DEF_JOKER_GFX(18)
-DEF_JOKER_GFX(19)
-DEF_JOKER_GFX(20)
-DEF_JOKER_GFX(21)
\ No newline at end of file
+DEF_JOKER_GFX(13)
\ No newline at end of file
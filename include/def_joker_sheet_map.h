@@ -0,0 +1,45 @@
+// Generated by scripts/pack_joker_sheets.py, don't edit
+// The spritesheet and the position in it of each joker, indexed by joker ID
+DEF_JOKER_SHEET_POS(0, 0) // 0
+DEF_JOKER_SHEET_POS(1, 0) // 1
+DEF_JOKER_SHEET_POS(2, 0) // 2
+DEF_JOKER_SHEET_POS(3, 0) // 3
+DEF_JOKER_SHEET_POS(3, 1) // 4
+DEF_JOKER_SHEET_POS(4, 0) // 5
+DEF_JOKER_SHEET_POS(3, 2) // 6
+DEF_JOKER_SHEET_POS(5, 0) // 7
+DEF_JOKER_SHEET_POS(0, 1) // 8
+DEF_JOKER_SHEET_POS(6, 0) // 9
+DEF_JOKER_SHEET_POS(7, 0) // 10
+DEF_JOKER_SHEET_POS(8, 0) // 11
+DEF_JOKER_SHEET_POS(5, 1) // 12
+DEF_JOKER_SHEET_POS(0, 2) // 13
+DEF_JOKER_SHEET_POS(5, 2) // 14
+DEF_JOKER_SHEET_POS(0, 3) // 15
+DEF_JOKER_SHEET_POS(9, 0) // 16
+DEF_JOKER_SHEET_POS(4, 1) // 17
+DEF_JOKER_SHEET_POS(10, 0) // 18
+DEF_JOKER_SHEET_POS(11, 0) // 19
+DEF_JOKER_SHEET_POS(12, 0) // 20
+DEF_JOKER_SHEET_POS(11, 1) // 21
+DEF_JOKER_SHEET_POS(0, 4) // 22
+DEF_JOKER_SHEET_POS(5, 3) // 23
+DEF_JOKER_SHEET_POS(10, 1) // 24
+DEF_JOKER_SHEET_POS(0, 5) // 25
+DEF_JOKER_SHEET_POS(5, 4) // 26
+DEF_JOKER_SHEET_POS(9, 1) // 27
+DEF_JOKER_SHEET_POS(6, 1) // 28
+DEF_JOKER_SHEET_POS(9, 2) // 29
+DEF_JOKER_SHEET_POS(6, 2) // 30
+DEF_JOKER_SHEET_POS(6, 3) // 31
+DEF_JOKER_SHEET_POS(0, 6) // 32
+DEF_JOKER_SHEET_POS(1, 1) // 33
+DEF_JOKER_SHEET_POS(11, 2) // 34
+DEF_JOKER_SHEET_POS(8, 1) // 35
+DEF_JOKER_SHEET_POS(8, 2) // 36
+DEF_JOKER_SHEET_POS(12, 1) // 37
+DEF_JOKER_SHEET_POS(12, 2) // 38
+DEF_JOKER_SHEET_POS(2, 1) // 39
+DEF_JOKER_SHEET_POS(13, 0) // 40
+DEF_JOKER_SHEET_POS(6, 4) // 41
+DEF_JOKER_SHEET_POS(7, 1) // 42
@@ -3,7 +3,9 @@
 
 #define MAX_HAND_SIZE 16
 #define MAX_DECK_SIZE 52
-#define MAX_JOKERS_HELD_SIZE 5 // This doesn't account for negatives right now.
+#define DEFAULT_JOKER_SLOTS 5
+#define MAX_JOKERS_HELD_SIZE 16 // Upper bound for the joker slots, including the extra slots from negatives and vouchers
+#define MAX_VISIBLE_HELD_JOKERS 8 // Held jokers past this are shown as compact icons
 #define MAX_SHOP_JOKERS 2 // TODO: Make this dynamic and allow for other items besides jokers
 #define MAX_SELECTION_SIZE 5
 #define MAX_CARD_SCORE_DIGITS 2 // Current digit limit for score received from cards including mult etc. from jokers
@@ -102,6 +104,7 @@ CardObject**    get_played_array(void);
 int             get_played_top(void);
 List*           get_jokers(void);
 bool            is_joker_owned(int joker_id);
+int             get_joker_slots(void);
 bool            card_is_face(Card *card);
 
 int get_deck_top(void);
@@ -109,6 +112,7 @@ int get_num_discards_remaining(void);
 int get_num_hands_remaining(void);
 int get_money(void);
 
+int game_get_bg_upload_bytes(void); // VRAM bytes written by the last background change
 int get_game_speed(void);
 void set_game_speed(int new_game_speed);
 
@@ -76,6 +76,18 @@ typedef RECT Rect;
  */
 SE main_bg_se_get_se(BG_POINT pos);
 
+/* The main background is edited in a RAM shadow of its screenblock and the rows
+ * that changed are copied by main_bg_se_commit() during VBlank, so a panel is never
+ * shown half drawn. The main background has to be accessed through these, not se_mem.
+ */
+const SE *main_bg_se_get_row(int y);
+SE *main_bg_se_edit_row(int y); // Marks the row to be committed
+void main_bg_se_copy_rows(const SE *src, int top, int num_rows);
+// Replaces the map right away, the tiles are replaced at the same time when the background changes
+void main_bg_se_load(const SE *map, int num_rows);
+void main_bg_se_commit(void); // Call during VBlank, only the rows on screen are copied
+uint main_bg_se_get_commit_bytes(void); // Of the last commit
+
 INLINE int rect_width(const Rect* rect)
 {
     /* Extra parens to avoid issues in case compiler turns INLINE into macro
@@ -109,6 +121,28 @@ void main_bg_se_clear_rect(Rect se_rect);
  */
 void main_bg_se_copy_rect_1_tile_vert(Rect se_rect, int direction);
 
+/* Same as calling main_bg_se_copy_rect_1_tile_vert() num_tiles times, in one pass.
+ * The rows the rect leaves behind are filled with its trailing edge row.
+ */
+void main_bg_se_copy_rect_n_tiles_vert(Rect se_rect, int direction, int num_tiles);
+
+/* One frame of sliding the bottom of a panel down from the top of the main background.
+ * After step n, rows 0 to n - 1 show the last n rows of src_rect.
+ * The rows already shown move down by one and only the new top row is copied,
+ * so the steps have to be done in order with num_rows_shown going 1, 2, 3...
+ */
+void main_bg_se_slide_down_step(Rect src_rect, int num_rows_shown);
+
+/* One frame of sliding a rect up by one tile, the same as main_bg_se_copy_rect_1_tile_vert()
+ * with SE_UP or main_bg_se_move_rect_1_tile_vert() with move, for the rows on screen.
+ * The rows below the screen stay where they are until main_bg_se_slide_up_finish(),
+ * the new bottom row on screen is read from them directly instead of shifting them every frame.
+ * The steps have to be done in order with step going 1, 2, 3...
+ */
+void main_bg_se_slide_up_step(Rect se_rect, int step, bool move);
+// Leaves the rows below the screen where num_steps single tile copies or moves would have
+void main_bg_se_slide_up_finish(Rect se_rect, int num_steps, bool move);
+
 /* Copies a rect in the main background from se_rect to the position (x, y).
  * se_rect dimensions are in number of tiles.
  * x and y are the coordinates in number of tiles.
@@ -8,20 +8,23 @@
 #include "game.h"
 #include "graphic_utils.h"
 
-// This won't be more than the number of jokers in your current deck
-// plus the amount that can fit in the shop, 8 should be fine. For now...
-#define MAX_ACTIVE_JOKERS 8
+// This won't be more than the number of jokers that can be held
+// plus the amount that can fit in the shop and one being sold.
+#define MAX_ACTIVE_JOKERS (MAX_JOKERS_HELD_SIZE + MAX_SHOP_JOKERS + 1)
+#define MAX_DEFINABLE_JOKERS 150
 
 #define JOKER_TID (MAX_HAND_SIZE + MAX_SELECTION_SIZE) * JOKER_SPRITE_OFFSET // Tile ID for the starting index in the tile memory
 #define JOKER_SPRITE_OFFSET 16 // Offset for the joker sprites
-#define JOKER_BASE_PB 4 // The starting palette index for the jokers
-#define JOKER_LAST_PB (NUM_PALETTES - 1) 
-// Currently allocating the rest of the palettes for the jokers.
-// This number needs to be decreased once we need to allocated palettes for other sprites
-// such as planet cards etc.
+// Joker palette banks are allocated from pal_bank.c per spritesheet and edition
 
 #define JOKER_STARTING_LAYER 27
 
+// Compact 16x16 icons for the held jokers that don't fit the visible strip.
+// Their tiles come right after the tiles of the full size joker sprites.
+#define JOKER_ICON_TID (JOKER_TID + MAX_JOKER_OBJECTS * JOKER_SPRITE_OFFSET)
+#define JOKER_ICON_SPRITE_OFFSET 4
+#define MAX_JOKER_ICONS (MAX_JOKERS_HELD_SIZE - MAX_VISIBLE_HELD_JOKERS)
+
 #define BASE_EDITION 0
 #define FOIL_EDITION 1
 #define HOLO_EDITION 2
@@ -55,7 +58,8 @@ typedef struct
 typedef struct JokerObject
 {
     Joker *joker;
-    SpriteObject* sprite_object;
+    SpriteObject sprite_object;
+    bool compact; // Drawn as a compact icon instead of the full size sprite
 } JokerObject;
 
 typedef struct  // These jokers are triggered after the played hand has finished scoring.
@@ -67,28 +71,116 @@ typedef struct  // These jokers are triggered after the played hand has finished
     bool retrigger; // Retrigger played hand (e.g. "Dusk" joker, even though on the wiki it says "On Scored" it makes more sense to have it here)
 } JokerEffect;
 
-typedef JokerEffect (*JokerEffectFunc)(Joker *joker, Card *scored_card);
+/* A JokerEffect packed into 64 bits so that it is returned in the r0:r1 register pair
+ * instead of through a memory return slot.
+ * Bits  0-15: chips
+ * Bits 16-31: mult
+ * Bits 32-39: xmult
+ * Bits 40-47: money
+ * Bit     48: retrigger
+ * A packed value of 0 means the joker had no effect.
+ */
+typedef u64 JokerEffectPacked;
+
+#define JOKER_EFFECT_NONE ((JokerEffectPacked)0)
+
+INLINE JokerEffectPacked joker_effect_pack(int chips, int mult, int xmult, int money, bool retrigger)
+{
+    return (JokerEffectPacked)(u16)chips
+         | ((JokerEffectPacked)(u16)mult << 16)
+         | ((JokerEffectPacked)(u8)xmult << 32)
+         | ((JokerEffectPacked)(u8)money << 40)
+         | ((JokerEffectPacked)(retrigger ? 1 : 0) << 48);
+}
+
+INLINE JokerEffect joker_effect_unpack(JokerEffectPacked packed)
+{
+    JokerEffect effect;
+    effect.chips = (u16)packed;
+    effect.mult = (u16)(packed >> 16);
+    effect.xmult = (u8)(packed >> 32);
+    effect.money = (u8)(packed >> 40);
+    effect.retrigger = (packed >> 48) & 1;
+    return effect;
+}
+
+typedef JokerEffectPacked (*JokerEffectFunc)(Joker *joker, Card *scored_card);
+
+// When a rule is evaluated. JOKER_TRIGGER_NONE means the joker uses its effect function instead.
+enum JokerTrigger
+{
+    JOKER_TRIGGER_NONE,
+    JOKER_TRIGGER_ON_SCORED,   // Once for every scored card
+    JOKER_TRIGGER_INDEPENDENT, // Once after the played hand has finished scoring
+};
+
+// What must hold for the rule to apply, checked against the rule's operand.
+enum JokerCondition
+{
+    JOKER_COND_ALWAYS,
+    JOKER_COND_CARD_SUIT_IS,      // operand: suit
+    JOKER_COND_CARD_RANK_IN,      // operand: mask of RANK_BIT()s
+    JOKER_COND_CARD_IS_FACE,
+    JOKER_COND_HAND_N_OF_A_KIND,  // operand: n
+    JOKER_COND_HAND_TWO_PAIR,
+    JOKER_COND_HAND_STRAIGHT,
+    JOKER_COND_HAND_FLUSH,
+    JOKER_COND_PLAYED_AT_MOST,    // operand: number of played cards
+    JOKER_COND_DISCARDS_LEFT_IS,  // operand: number of discards
+    JOKER_COND_HANDS_LEFT_IS,     // operand: number of hands
+};
+
+// What the chips and mult of a rule are multiplied by.
+enum JokerScaler
+{
+    JOKER_SCALE_NONE,
+    JOKER_SCALE_DISCARDS_LEFT,
+    JOKER_SCALE_DECK_SIZE,
+    JOKER_SCALE_JOKERS_HELD,
+    JOKER_SCALE_MONEY,
+    JOKER_SCALE_MONEY_PER_5,
+};
+
+#define RANK_BIT(rank) (1 << (rank))
+
+typedef struct
+{
+    u8 trigger;   // enum JokerTrigger
+    u8 condition; // enum JokerCondition
+    u8 scaler;    // enum JokerScaler
+    u8 xmult;
+    u16 operand;
+    u16 chips;
+    u16 mult;
+    u8 money;
+} JokerRule;
+
 typedef struct {
     u8 rarity;
     u8 base_value;
-    JokerEffectFunc effect;
+    JokerRule rule;
+    JokerEffectFunc effect; // Only used by bespoke jokers whose rule trigger is JOKER_TRIGGER_NONE
 } JokerInfo;
 const JokerInfo* get_joker_registry_entry(int joker_id);
+JokerEffectPacked joker_rule_evaluate(const JokerRule *rule, Card *scored_card);
 size_t get_joker_registry_size(void);
 
 void joker_init();
+void joker_palettes_update(); // Animates the edition palettes, once per frame
 
-Joker *joker_new(u8 id);
+u8 joker_roll_edition(void);
+Joker *joker_new(u8 id, u8 edition);
 void joker_destroy(Joker **joker);
 
 // Unique effects like "Four Fingers" or "Credit Card" will be hard coded into game.c with a conditional check for the joker ID from the players owned jokers
 // game.c should probably be restructured so most of the variables in it are moved to some sort of global variable header file so they can be easily accessed and modified for the jokers
-JokerEffect joker_get_score_effect(Joker *joker, Card *scored_card);
+JokerEffectPacked joker_get_score_effect(Joker *joker, Card *scored_card);
 int joker_get_sell_value(const Joker* joker);
 
 JokerObject *joker_object_new(Joker *joker);
 void joker_object_destroy(JokerObject **joker_object);
 void joker_object_update(JokerObject *joker_object);
+void joker_object_set_compact(JokerObject *joker_object, bool compact);
 void joker_object_shake(JokerObject *joker_object, mm_word sound_id); // This doesn't actually score anything, it just performs an animation and plays a sound effect
 bool joker_object_score(JokerObject *joker_object, Card* scored_card, int *chips, int *mult, int *xmult, int *money, bool *retrigger); // This scores the joker and returns true if it was scored successfully (Card = NULL means the joker is independent and not scored by a card)
 
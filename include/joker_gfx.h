@@ -1,27 +1,19 @@
-#ifndef JOKER_GFX_H
-#define JOKER_GFX_H
-
-#include "joker_gfx0.h"
-#include "joker_gfx1.h"
-#include "joker_gfx2.h"
-#include "joker_gfx3.h"
-#include "joker_gfx4.h"
-#include "joker_gfx5.h"
-#include "joker_gfx6.h"
-#include "joker_gfx7.h"
-#include "joker_gfx8.h"
-#include "joker_gfx9.h"
-#include "joker_gfx10.h"
-#include "joker_gfx11.h"
-#include "joker_gfx12.h"
-#include "joker_gfx13.h"
-#include "joker_gfx14.h"
-#include "joker_gfx15.h"
-#include "joker_gfx16.h"
-#include "joker_gfx17.h"
-#include "joker_gfx18.h"
-#include "joker_gfx19.h"
-#include "joker_gfx20.h"
-#include "joker_gfx21.h"
-
+#ifndef JOKER_GFX_H
+#define JOKER_GFX_H
+
+#include "joker_gfx0.h"
+#include "joker_gfx1.h"
+#include "joker_gfx2.h"
+#include "joker_gfx3.h"
+#include "joker_gfx4.h"
+#include "joker_gfx5.h"
+#include "joker_gfx6.h"
+#include "joker_gfx7.h"
+#include "joker_gfx8.h"
+#include "joker_gfx9.h"
+#include "joker_gfx10.h"
+#include "joker_gfx11.h"
+#include "joker_gfx12.h"
+#include "joker_gfx13.h"
+
 #endif
\ No newline at end of file
@@ -0,0 +1,48 @@
+#ifndef PAL_BANK_H
+#define PAL_BANK_H
+
+#include <tonc.h>
+
+#include "graphic_utils.h"
+
+/* Refcounted allocator for the 16 color palette banks of objects and 4bpp backgrounds.
+ * Identical palettes share a bank. A bank nobody uses anymore keeps its colors until
+ * it's needed for another palette, least recently released first, so acquiring it
+ * again doesn't copy anything.
+ * The colors go into the shadow palette, see pal_fx.h for how it's uploaded.
+ */
+
+// In the same order as in the palette memory
+enum PalBankType
+{
+    PAL_BANK_BG,
+    PAL_BANK_OBJ,
+    PAL_BANK_NUM_TYPES
+};
+
+/* Every color is set here instead of pal_bg_mem/pal_obj_mem, including the banks
+ * outside the allocator, and the whole palette is uploaded every VBlank.
+ * Writing the palette memory directly would be overwritten at the next VBlank.
+ */
+extern COLOR pal_shadow[PAL_BANK_NUM_TYPES][NUM_PALETTES * PAL_ROW_LEN];
+#define pal_bg_shadow (pal_shadow[PAL_BANK_BG])
+#define pal_obj_shadow (pal_shadow[PAL_BANK_OBJ])
+
+#define PAL_BANK_VARIANT_PLAIN 0 // The colors are used as they are
+
+void pal_bank_init(void); // Starts the shadow from the palette memory
+// Keeps a bank out of the allocator, for fixed layouts such as 8bpp backgrounds and the text colors
+void pal_bank_reserve(enum PalBankType type, int bank);
+/* Returns a bank with the first 16 colors of src, or UNDEFINED if they're all in use.
+ * Palettes that get modified after loading need their own variant so they aren't shared
+ * with the plain colors, is_new (optional) tells whether the changes have to be applied.
+ * src is compared against to share banks so it has to stay valid, it should be in ROM.
+ */
+int pal_bank_acquire(enum PalBankType type, const COLOR *src, u8 variant, bool *is_new);
+void pal_bank_add_user(enum PalBankType type, int bank);
+void pal_bank_release(enum PalBankType type, int bank);
+COLOR *pal_bank_edit(enum PalBankType type, int bank); // The shadow colors of the bank
+int pal_bank_get_num_free(enum PalBankType type); // Banks that can still be acquired
+uint pal_bank_get_num_exhausted(void); // Acquisitions that failed because every bank was in use
+
+#endif // PAL_BANK_H
@@ -0,0 +1,35 @@
+#ifndef PAL_FX_H
+#define PAL_FX_H
+
+#include <tonc.h>
+
+#include "pal_bank.h"
+
+/* Palette effects on top of the shadow palette (see pal_bank.h).
+ * The shadow is uploaded with one DMA every VBlank, through a fade if one is showing,
+ * so the cost doesn't depend on how many colors changed.
+ * A fade blends every color towards one color with per channel tables that are only
+ * rebuilt when the amount changes. Color cycles rotate a set of shadow colors.
+ */
+
+#define PAL_FX_FADE_MAX 32 // Fully the fade color
+#define PAL_FX_MAX_CYCLES 4
+
+void pal_fx_init(void);
+// Fades from one amount to another, 0 shows the palette as it is
+void pal_fx_fade(COLOR color, int from, int to, int frames);
+bool pal_fx_is_fading(void);
+/* Every period frames each of the colors at the indices takes the color of the one before it,
+ * the first one takes the last one's. The indices aren't copied so they have to be const.
+ * Returns the cycle index or UNDEFINED if all the cycles are in use.
+ */
+int pal_fx_cycle_start(enum PalBankType type, const u8 *indices, int num_indices, int period);
+void pal_fx_cycle_stop(int cycle);
+void pal_fx_update(void); // Once per frame, after the colors for the frame are set
+void pal_fx_draw(void);   // Call during VBlank
+/* Writes one type's shadow colors to palette memory right away, through the fade showing.
+ * Only for when tiles are replaced in the middle of the frame and can't wait for their colors.
+ */
+void pal_fx_show_now(enum PalBankType type);
+
+#endif // PAL_FX_H
@@ -0,0 +1,29 @@
+#ifndef QUALITY_H
+#define QUALITY_H
+
+#include <tonc.h>
+
+/* Quality governor, keeps the game at 60 fps by turning effects off when a
+ * frame takes too long and back on once there is headroom again.
+ * The time between the end of VBlankIntrWait() and the end of the update is
+ * measured with timer 1 (maxmod uses timer 0, the profiler timers 2 and 3).
+ */
+
+// Each tier also drops the effects of the tiers before it
+enum QualityTier
+{
+    QUALITY_TIER_FULL,
+    QUALITY_TIER_FLAT_BACKGROUND, // The main menu background uses one transform per frame instead of one per scanline
+    QUALITY_TIER_NO_TILT,         // Moving sprites don't tilt with their velocity
+    QUALITY_TIER_NO_SHAKE,        // Shaken sprites only play their sound
+    QUALITY_TIER_NUM
+};
+
+void quality_init(void);
+void quality_frame_start(void); // Right after VBlankIntrWait()
+void quality_frame_end(void);   // Once the frame's work is done, may change the tier
+enum QualityTier quality_get_tier(void);
+uint quality_get_num_overruns(void); // Frames that missed the next VBlank
+uint quality_get_load_percent(void); // Of the last frame
+
+#endif // QUALITY_H
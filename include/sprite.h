@@ -4,17 +4,19 @@
 #include <tonc.h>
 #include <maxmod.h>
 
+#include "tween.h"
+
 #define CARD_SPRITE_SIZE 32
 #define MAX_SPRITES 128
-#define MAX_SPRITE_OBJECTS 16
 
 
 typedef struct 
 {
-    OBJ_ATTR *obj;
+    OBJ_ATTR obj; // Copied to an OAM entry by sprite_build_oam(), the entry depends on the layer
     OBJ_AFFINE *aff;
     POINT pos;
-    int idx;
+    int layer; // Lower layers are drawn on top
+    u32 upload_ticket; // Not drawn until this vram_queue copy of its tiles has landed
 } Sprite;
 
 // A sprite object is a sprite that is selectable and movable in animation
@@ -32,39 +34,64 @@ typedef struct
     FIXED vrotation;
     bool selected;
     bool focused;
-    
+    bool tweening; // Tweens drive the target and the position follows it without the spring
+    TweenCallback on_tween_done;
+    void *tween_data;
 } SpriteObject;
 
 // Sprite methods
-Sprite *sprite_new(u16 a0, u16 a1, u32 tid, u32 pb, int sprite_index);
+Sprite *sprite_new(u16 a0, u16 a1, u32 tid, u32 pb, int layer);
 Sprite *affine_sprite_new(u16 a0, u16 a1, u32 tid, u32 pb);
 void sprite_destroy(Sprite **sprite);
 int sprite_get_layer(Sprite *sprite);
+void sprite_set_layer(Sprite *sprite, int layer); // Takes effect at the next sprite_build_oam()
+void sprite_set_upload_ticket(Sprite *sprite, u32 ticket);
+bool sprite_is_on_screen(const Sprite *sprite); // Off screen sprites are culled from OAM
+// Affine sprites only, the matrix is shared with the other sprites with the same transform
+void sprite_rotscale(Sprite *sprite, FIXED scale, u16 alpha);
+bool sprite_shows_rotscale(const Sprite *sprite, FIXED scale, u16 alpha);
+void sprite_hide(Sprite *sprite);
+void sprite_unhide(Sprite *sprite, u16 mode);
 INLINE void sprite_position(Sprite *sprite, int x, int y)
 {
+    if (sprite->pos.x == x && sprite->pos.y == y)
+        return;
+
     sprite->pos.x = x;
     sprite->pos.y = y;
 
-    obj_set_pos(sprite->obj, x, y);
+    obj_set_pos(&sprite->obj, x, y);
 }
 
 // Sprite functions
 void sprite_init();
+void sprite_build_oam();
 void sprite_draw();
+uint sprite_get_oam_upload_bytes(); // Bytes uploaded by the last sprite_draw()
+int sprite_get_num_affines_in_use(); // Shared affine matrices currently in use
 int sprite_get_pb(const Sprite* sprite);
 
 // SpriteObject methods
-SpriteObject *sprite_object_new();
-void sprite_object_destroy(SpriteObject **sprite_object);
+void sprite_object_init(SpriteObject *sprite_object);
+void sprite_object_deinit(SpriteObject *sprite_object); // Destroys the sprite and cancels the tweens moving the object
 void sprite_object_set_sprite(SpriteObject* sprite_object, Sprite* sprite);
 void sprite_object_reset_transform(SpriteObject* sprite_object);
-void sprite_object_update(SpriteObject *sprite_object);
+// In sprite_object.iwram.c, built as ARM code
+IWRAM_CODE void sprite_object_update(SpriteObject *sprite_object);
+// Integrates a batch of objects together, each object must appear at most once
+IWRAM_CODE void sprite_object_update_batch(SpriteObject **sprite_objects, int count);
+void sprite_object_set_game_speed(int game_speed);
 void sprite_object_shake(SpriteObject* sprite_object, mm_word sound_id);
+// Moves the object to (x, y) along an easing curve in a fixed number of frames instead of with the spring.
+// Returns false without moving it if no tweens are free, on_complete won't be called then.
+bool sprite_object_tween_to(SpriteObject* sprite_object, FIXED x, FIXED y, int frames, EaseType ease, TweenCallback on_complete, void *data);
 
 void sprite_object_set_selected(SpriteObject* sprite_object, bool selected);
 bool sprite_object_is_selected(SpriteObject* sprite_object);
 Sprite* sprite_object_get_sprite(SpriteObject* sprite_object);
 void sprite_object_set_focus(SpriteObject* sprite_object, bool focus);
 bool sprite_object_is_focused(SpriteObject* sprite_object);
+// True once the object is fully off screen and heading somewhere off screen, so it can be retired
+bool sprite_object_has_left_screen(const SpriteObject* sprite_object);
 
 #endif // SPRITE_H
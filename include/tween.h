@@ -0,0 +1,47 @@
+#ifndef TWEEN_H
+#define TWEEN_H
+
+#include <tonc.h>
+
+#define MAX_TWEENS 32 // Fits the active bitmap in one word
+#define EASE_LUT_STEPS 64
+
+typedef enum
+{
+    EASE_LINEAR,
+    EASE_IN_QUAD,
+    EASE_OUT_QUAD,
+    EASE_IN_OUT_QUAD,
+    EASE_OUT_BACK, // Overshoots the end value a little and settles back
+    EASE_NUM
+} EaseType;
+
+// One keyframe of a track, the value is reached after the given number of frames
+typedef struct
+{
+    FIXED value;
+    u16 frames;
+    u8 ease;
+} TweenKey;
+
+// Called once after the last key of a track is reached.
+// All the tweens are stepped before any callback runs, so it may destroy what the tweens were animating.
+typedef void (*TweenCallback)(void *data);
+
+/* Animates *value through the keys of a track, starting from its current value.
+ * Durations are in frames and don't depend on the game speed.
+ * The keys aren't copied so they have to outlive the track, declare them const.
+ * Returns the tween index or UNDEFINED if all the tweens are in use.
+ */
+int tween_start_track(FIXED *value, const TweenKey *keys, int num_keys, TweenCallback on_complete, void *data);
+// Single key track
+int tween_start(FIXED *value, FIXED to, int frames, EaseType ease, TweenCallback on_complete, void *data);
+void tween_cancel(int tween_index); // The callback isn't called
+// Cancels every tween animating a value within [start, start + size), call before freeing an object
+void tween_cancel_range(const void *start, uint size);
+bool tween_is_active(int tween_index);
+
+void tween_update(void); // Steps the active tweens, once per frame
+int tween_get_num_active(void);
+
+#endif // TWEEN_H
@@ -0,0 +1,25 @@
+#ifndef VRAM_QUEUE_H
+#define VRAM_QUEUE_H
+
+#include <tonc.h>
+
+/* Queue of copies to VRAM, drained by DMA during VBlank so uploads made
+ * mid-frame don't tear and large batches (a new hand, a shop reroll) are
+ * spread over several frames instead of stalling one.
+ * The source has to stay valid until the copy has landed, so only queue
+ * copies from ROM or static buffers.
+ */
+
+#define VRAM_QUEUE_SIZE 32 // Jobs in flight
+#define VRAM_QUEUE_FRAME_BUDGET 4096 // Bytes copied per VBlank, 8 card faces
+
+#define VRAM_QUEUE_NO_TICKET 0 // Always done
+
+// Returns a ticket for vram_queue_is_done(). num_bytes must be a multiple of 4.
+// When the queue is full the oldest copy is done right away.
+u32 vram_queue_push(void *dst, const void *src, uint num_bytes);
+bool vram_queue_is_done(u32 ticket);
+void vram_queue_process(void); // Call during VBlank
+uint vram_queue_get_num_pending_bytes(void);
+
+#endif // VRAM_QUEUE_H
@@ -0,0 +1,321 @@
+#!/usr/bin/env python3
+"""Packs the joker art into spritesheets that share a 16 color palette.
+
+Each joker is drawn in its own 32x32 image, graphics/jokers/joker_<id>.png.
+Jokers are grouped so every spritesheet fits in one palette bank (15 colors
+plus transparency), which keeps the number of palette banks used at runtime
+and the palette uploads as low as possible.
+
+Generates, overwriting the previous output:
+    graphics/joker_gfx<sheet>.png/.grit  the spritesheets, 4bpp indexed
+    include/joker_gfx.h                  includes the grit headers
+    include/def_joker_gfx_table.h        one DEF_JOKER_GFX(sheet) per sheet
+    include/def_joker_sheet_map.h        one DEF_JOKER_SHEET_POS(sheet, slot) per joker ID
+
+The joker IDs come from the file names so they stay stable no matter how the
+jokers are packed. Only the Python standard library is needed.
+The build runs it whenever the joker art is newer than the output, files that
+are already up to date are left untouched. `make joker_sheets` forces a run.
+"""
+
+import argparse
+import glob
+import os
+import re
+import struct
+import sys
+import zlib
+
+JOKER_SIZE = 32
+MAX_SHEET_COLORS = 15  # Color 0 is transparent
+GRIT_OPTIONS = "-gB4 -Mw4 -Mh4 -m! -pn16"
+
+ROOT_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+
+
+def read_png(path):
+    """Returns the width, height and rows of (r, g, b, a) pixels of an 8 bit PNG."""
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        sys.exit(f"{path}: not a PNG file")
+
+    pos = 8
+    idat = b""
+    palette = []
+    alphas = b""
+    while pos < len(data):
+        length, = struct.unpack(">I", data[pos:pos + 4])
+        chunk_type = data[pos + 4:pos + 8]
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+
+        if chunk_type == b"IHDR":
+            width, height, bit_depth, color_type, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif chunk_type == b"PLTE":
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, length, 3)]
+        elif chunk_type == b"tRNS":
+            alphas = chunk
+        elif chunk_type == b"IDAT":
+            idat += chunk
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color_type]
+    if bit_depth != 8 or interlace:
+        sys.exit(f"{path}: only 8 bit non-interlaced PNGs are supported")
+
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    prev = bytearray(stride)
+    rows = []
+    pos = 0
+    for _ in range(height):
+        filter_type = raw[pos]
+        line = bytearray(raw[pos + 1:pos + 1 + stride])
+        pos += 1 + stride
+
+        for x in range(stride):
+            a = line[x - channels] if x >= channels else 0
+            b = prev[x]
+            c = prev[x - channels] if x >= channels else 0
+            if filter_type == 1:
+                line[x] = (line[x] + a) & 0xFF
+            elif filter_type == 2:
+                line[x] = (line[x] + b) & 0xFF
+            elif filter_type == 3:
+                line[x] = (line[x] + ((a + b) >> 1)) & 0xFF
+            elif filter_type == 4:
+                pa, pb, pc = abs(b - c), abs(a - c), abs(a + b - 2 * c)
+                predictor = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[x] = (line[x] + predictor) & 0xFF
+
+        row = []
+        for x in range(width):
+            px = line[x * channels:(x + 1) * channels]
+            if color_type == 0:
+                row.append((px[0], px[0], px[0], 255))
+            elif color_type == 2:
+                row.append((px[0], px[1], px[2], 255))
+            elif color_type == 3:
+                alpha = alphas[px[0]] if px[0] < len(alphas) else 255
+                row.append(palette[px[0]] + (alpha,))
+            elif color_type == 4:
+                row.append((px[0], px[0], px[0], px[1]))
+            else:
+                row.append(tuple(px))
+        rows.append(row)
+        prev = line
+
+    return width, height, rows
+
+
+def write_if_changed(path, data):
+    """Leaves files that are already up to date alone so their timestamps don't trigger rebuilds."""
+    if os.path.exists(path):
+        with open(path, "rb") as f:
+            if f.read() == data:
+                return False
+
+    with open(path, "wb") as f:
+        f.write(data)
+    return True
+
+
+def write_indexed_png(path, width, height, palette, indices):
+    """Writes an 8 bit indexed PNG, grit keeps the palette order of indexed images.
+    An existing PNG with the same pixels and palette is kept, zlib versions don't all
+    compress the same way so comparing the bytes isn't enough."""
+    if os.path.exists(path):
+        old_width, old_height, rows = read_png(path)
+        if (old_width, old_height) == (width, height) and \
+                [px for row in rows for px in row] == [palette[i] + (255,) for i in indices]:
+            return False
+
+    def chunk(chunk_type, payload):
+        return (struct.pack(">I", len(payload)) + chunk_type + payload
+                + struct.pack(">I", zlib.crc32(chunk_type + payload) & 0xFFFFFFFF))
+
+    raw = b"".join(b"\x00" + bytes(indices[y * width:(y + 1) * width]) for y in range(height))
+    with open(path, "wb") as f:
+        f.write(b"\x89PNG\r\n\x1a\n")
+        f.write(chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 3, 0, 0, 0)))
+        f.write(chunk(b"PLTE", b"".join(bytes(color) for color in palette)))
+        f.write(chunk(b"IDAT", zlib.compress(raw, 9)))
+        f.write(chunk(b"IEND", b""))
+    return True
+
+
+def to_gba(color):
+    """The 15 bit color the GBA will show, colors that only differ below it are the same."""
+    return (color[0] >> 3, color[1] >> 3, color[2] >> 3)
+
+
+def color_distance(a, b):
+    return max(abs(a[i] - b[i]) for i in range(3))
+
+
+class Joker:
+    def __init__(self, joker_id, path):
+        width, height, rows = read_png(path)
+        if (width, height) != (JOKER_SIZE, JOKER_SIZE):
+            sys.exit(f"{path}: jokers have to be {JOKER_SIZE}x{JOKER_SIZE}")
+
+        self.id = joker_id
+        self.pixels = [None if px[3] == 0 else to_gba(px) for row in rows for px in row]
+        self.rgb = {}  # The first 8 bit color seen for each GBA color, for the PNG palette
+        for row in rows:
+            for px in row:
+                if px[3] != 0:
+                    self.rgb.setdefault(to_gba(px), px[:3])
+
+        if any(px[3] not in (0, 255) for row in rows for px in row):
+            sys.exit(f"{path}: pixels have to be either opaque or transparent")
+        if len(self.rgb) > MAX_SHEET_COLORS:
+            sys.exit(f"{path}: {len(self.rgb)} colors, at most {MAX_SHEET_COLORS} fit in a palette bank")
+
+
+class Sheet:
+    def __init__(self):
+        self.jokers = []
+        self.colors = []  # GBA colors in palette order, after the transparent color
+        self.rgb = {}
+
+    def match(self, joker, tolerance):
+        """Returns how each color of the joker maps to the sheet palette or None if it doesn't fit."""
+        mapping = {}
+        new_colors = []
+        for color in joker.rgb:
+            candidates = [c for c in self.colors + new_colors if color_distance(c, color) <= tolerance]
+            if candidates:
+                mapping[color] = min(candidates, key=lambda c: color_distance(c, color))
+            else:
+                new_colors.append(color)
+                mapping[color] = color
+
+        if len(self.colors) + len(new_colors) > MAX_SHEET_COLORS:
+            return None
+
+        return mapping, new_colors
+
+    def add(self, joker, mapping, new_colors):
+        self.jokers.append((joker, mapping))
+        self.colors += new_colors
+        for color in new_colors:
+            self.rgb[color] = joker.rgb[color]
+
+
+def pack(jokers, tolerance, max_jokers_per_sheet):
+    """Best fit decreasing: the most colorful jokers are placed first, each in the sheet
+    it adds the fewest new colors to, so jokers with similar palettes end up together."""
+    sheets = []
+    for joker in sorted(jokers, key=lambda j: (-len(j.rgb), j.id)):
+        best = None
+        for sheet in sheets:
+            if len(sheet.jokers) >= max_jokers_per_sheet:
+                continue
+
+            fit = sheet.match(joker, tolerance)
+            if fit is not None and (best is None or len(fit[1]) < len(best[1][1])):
+                best = (sheet, fit)
+
+        if best is None:
+            sheet = Sheet()
+            sheets.append(sheet)
+            best = (sheet, sheet.match(joker, tolerance))
+
+        best[0].add(joker, *best[1])
+
+    # Keep the output stable and roughly in ID order
+    for sheet in sheets:
+        sheet.jokers.sort(key=lambda entry: entry[0].id)
+    sheets.sort(key=lambda sheet: sheet.jokers[0][0].id)
+    return sheets
+
+
+def write_sheet(sheet, sheet_idx, graphics_dir):
+    palette = [(0, 0, 0)] + [sheet.rgb[color] for color in sheet.colors]
+    palette_idx = {color: i + 1 for i, color in enumerate(sheet.colors)}
+
+    width = JOKER_SIZE * len(sheet.jokers)
+    indices = [0] * (width * JOKER_SIZE)
+    for slot, (joker, mapping) in enumerate(sheet.jokers):
+        for i, color in enumerate(joker.pixels):
+            if color is not None:
+                y, x = divmod(i, JOKER_SIZE)
+                indices[y * width + slot * JOKER_SIZE + x] = palette_idx[mapping[color]]
+
+    base = os.path.join(graphics_dir, f"joker_gfx{sheet_idx}")
+    changed = write_indexed_png(base + ".png", width, JOKER_SIZE, palette, indices)
+    changed |= write_if_changed(base + ".grit", GRIT_OPTIONS.encode())
+    return changed
+
+
+def write_headers(sheets, num_ids, include_dir):
+    changed = write_if_changed(os.path.join(include_dir, "joker_gfx.h"), (
+        "#ifndef JOKER_GFX_H\n#define JOKER_GFX_H\n\n"
+        + "".join(f'#include "joker_gfx{i}.h"\n' for i in range(len(sheets)))
+        + "\n#endif").encode())
+
+    changed |= write_if_changed(os.path.join(include_dir, "def_joker_gfx_table.h"),
+                                "\n".join(f"DEF_JOKER_GFX({i})" for i in range(len(sheets))).encode())
+
+    positions = {}
+    for sheet_idx, sheet in enumerate(sheets):
+        for slot, (joker, _) in enumerate(sheet.jokers):
+            positions[joker.id] = (sheet_idx, slot)
+
+    sheet_map = "// Generated by scripts/pack_joker_sheets.py, don't edit\n"
+    sheet_map += "// The spritesheet and the position in it of each joker, indexed by joker ID\n"
+    for joker_id in range(num_ids):
+        # IDs without art use the first joker so they still show something
+        sheet_idx, slot = positions.get(joker_id, (0, 0))
+        sheet_map += f"DEF_JOKER_SHEET_POS({sheet_idx}, {slot}) // {joker_id}\n"
+
+    changed |= write_if_changed(os.path.join(include_dir, "def_joker_sheet_map.h"), sheet_map.encode())
+    return changed
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--tolerance", type=int, default=0,
+                        help="merge colors that differ by up to this much per 5 bit channel (default: 0, lossless)")
+    parser.add_argument("--max-jokers-per-sheet", type=int, default=8)
+    parser.add_argument("--check", action="store_true",
+                        help="only print something and fail if the output had to be regenerated")
+    args = parser.parse_args()
+
+    graphics_dir = os.path.join(ROOT_DIR, "graphics")
+    include_dir = os.path.join(ROOT_DIR, "include")
+
+    jokers = []
+    for path in glob.glob(os.path.join(graphics_dir, "jokers", "joker_*.png")):
+        match = re.fullmatch(r"joker_(\d+)\.png", os.path.basename(path))
+        if match:
+            jokers.append(Joker(int(match.group(1)), path))
+
+    if not jokers:
+        sys.exit("No joker art found in graphics/jokers")
+
+    sheets = pack(jokers, args.tolerance, args.max_jokers_per_sheet)
+
+    changed = False
+    # Spritesheets left over from a previous packing that needed more of them
+    for path in glob.glob(os.path.join(graphics_dir, "joker_gfx*")):
+        match = re.fullmatch(r"joker_gfx(\d+)\.(png|grit)", os.path.basename(path))
+        if match and int(match.group(1)) >= len(sheets):
+            os.remove(path)
+            changed = True
+    for sheet_idx, sheet in enumerate(sheets):
+        changed |= write_sheet(sheet, sheet_idx, graphics_dir)
+    changed |= write_headers(sheets, max(joker.id for joker in jokers) + 1, include_dir)
+
+    if args.check:
+        if changed:
+            sys.exit("The joker spritesheets were out of date with graphics/jokers and have been regenerated, "
+                     "commit the changes")
+    else:
+        print(f"{len(jokers)} jokers packed in {len(sheets)} spritesheets")
+
+
+if __name__ == "__main__":
+    main()
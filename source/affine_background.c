@@ -3,19 +3,60 @@
 #include "affine_main_menu_background_gfx.h"
 
 #include "graphic_utils.h"
+#include "pal_bank.h"
+#include "quality.h"
 
 #define ANIMATION_SPEED_DIVISOR 16
 
+#define MAIN_MENU_TEX_POS (1000 * 1000)
+#define MAIN_MENU_SCALE 128
+#define BG_ROTATION_STEP_SHIFT 7 // lu_sin() ignores the low 7 bits of the angle
+#define BG_ROTATION_STEPS 512
+
 BG_AFFINE bgaff_arr[SCREEN_HEIGHT + 1];
 
+/* The main menu background transform of the first scanline for each
+ * rotation step, before the wave offset is added.
+ * The other scanlines only differ by a translation along the matrix columns
+ * so a row is one lookup, one copy and two multiplies.
+ */
+EWRAM_BSS static BG_AFFINE bg_rotation_lut[BG_ROTATION_STEPS];
+
 AFF_SRC_EX asx = {0};
 
 enum AffineBackgroundID background = AFFINE_BG_MAIN_MENU;
 
 static uint timer = 0;
 
+static const COLOR *palette_src = affine_background_gfxPal; // The colors before affine_background_set_color()
+
+// Whether the current background wants to be transformed per scanline (high quality mode)
+static bool per_scanline_requested = true;
+// Whether it actually is, the quality governor can turn it off
+static bool per_scanline_enabled = true;
+
+static void affine_background_init_rotation_lut()
+{
+    AFF_SRC_EX rotation_src =
+    {
+        .tex_x = MAIN_MENU_TEX_POS,
+        .tex_y = MAIN_MENU_TEX_POS,
+        .scr_x = SCREEN_WIDTH / 2, // 128 on x and y is an offset used to center the rotation
+        .scr_y = -(SCREEN_HEIGHT / 2),
+        .sx = MAIN_MENU_SCALE,
+        .sy = MAIN_MENU_SCALE,
+    };
+
+    for (int i = 0; i < BG_ROTATION_STEPS; i++)
+    {
+        rotation_src.alpha = i << BG_ROTATION_STEP_SHIFT;
+        bg_rotscale_ex(&bg_rotation_lut[i], &rotation_src);
+    }
+}
+
 void affine_background_init()
 {   
+    affine_background_init_rotation_lut();
     affine_background_update();
 
     REG_BG_AFFINE[AFFINE_BG_IDX] = bg_aff_default;
@@ -25,24 +66,24 @@ void affine_background_init()
 // and stores in bgaff_arr. 
 // This is to be done in VBLANK so the HBLANK code 
 // can just fetch the values quickly.
+// Gives the same rows as calling bg_rotscale_ex() with tex_x offset by the
+// wave and scr_y = vcount - SCREEN_HEIGHT / 2, see bg_rotation_lut.
 IWRAM_CODE void affine_background_prep_bgaff_arr()
 {
-    for (u16 vcount = 0; vcount < SCREEN_HEIGHT; vcount++)
+    const s32 timer_s32 = timer << 8;
+    const s32 phase = timer_s32 / ANIMATION_SPEED_DIVISOR; // dividing the timer by 16 to make the animation slower
+
+    for (int vcount = 0; vcount < SCREEN_HEIGHT; vcount++)
     {
-        const s32 timer_s32 = timer << 8;
-        const s32 vcount_s32 = vcount << 8;
-        const s16 vcount_s16 = vcount;
-        const s32 vcount_sine = lu_sin(vcount_s32 + timer_s32 / ANIMATION_SPEED_DIVISOR); // dividing the timer by 16 to make the animation slower
-        
-        asx.scr_x = (SCREEN_WIDTH / 2); // 128 on x and y is an offset used to center the rotation
-        asx.scr_y = vcount_s16 - (SCREEN_HEIGHT / 2); // scr_y must equal vcount otherwise the background will have no vertical difference
-        asx.tex_x = (1000 * 1000) + (vcount_sine);
-        asx.tex_y = (1000 * 1000);
-        asx.sx = 128;
-        asx.sy = 128;
-        asx.alpha = vcount_sine + (timer_s32 / ANIMATION_SPEED_DIVISOR);
-
-        bg_rotscale_ex(&bgaff_arr[vcount], &asx);
+        const s32 vcount_sine = lu_sin((vcount << 8) + phase);
+        const u16 alpha = vcount_sine + phase;
+        const BG_AFFINE *rotation = &bg_rotation_lut[alpha >> BG_ROTATION_STEP_SHIFT];
+        BG_AFFINE *row = &bgaff_arr[vcount];
+
+        *row = *rotation;
+        // scr_y must follow vcount otherwise the background will have no vertical difference
+        row->dx += vcount_sine - rotation->pb * vcount;
+        row->dy -= rotation->pd * vcount;
     }
 
     /* HBLANK occurs after the scanline so REG_VCOUNT represents the 
@@ -52,6 +93,26 @@ IWRAM_CODE void affine_background_prep_bgaff_arr()
     bgaff_arr[SCREEN_HEIGHT] = bgaff_arr[0];
 }
 
+/* By default the rows are streamed by DMA0 in HBLANK repeat mode, which
+ * costs a few bus cycles per scanline instead of an interrupt per scanline.
+ * The transfer doesn't run during VBLANK, so it's re-armed here every frame:
+ * the first line is written directly and the DMA writes the next row at the
+ * end of each scanline.
+ * Building with AFFINE_BG_HBLANK_IRQ uses affine_background_hblank() instead.
+ */
+IWRAM_CODE void affine_background_vblank()
+{
+#ifndef AFFINE_BG_HBLANK_IRQ
+    if (!per_scanline_enabled)
+    {
+        return;
+    }
+
+    REG_BG_AFFINE[AFFINE_BG_IDX] = bgaff_arr[0];
+    dma_cpy(&REG_BG_AFFINE[AFFINE_BG_IDX], &bgaff_arr[1], sizeof(BG_AFFINE) / sizeof(u32), 0, DMA_HDMA | DMA_32);
+#endif
+}
+
 IWRAM_CODE void affine_background_hblank()
 {
     vu16 vcount = REG_VCOUNT;
@@ -65,13 +126,40 @@ IWRAM_CODE void affine_background_hblank()
     REG_BG_AFFINE[AFFINE_BG_IDX] = bgaff_arr[vcount + 1];
 }
 
+static void affine_background_set_per_scanline(bool enabled)
+{
+    per_scanline_enabled = enabled;
+
+#ifdef AFFINE_BG_HBLANK_IRQ
+    if (enabled)
+    {
+        REG_IE |= IRQ_HBLANK;
+    }
+    else
+    {
+        REG_IE &= ~IRQ_HBLANK;
+    }
+#else
+    if (!enabled)
+    {
+        REG_DMA0CNT = 0; // Stop the transfer, it's re-armed at the next VBLANK otherwise
+    }
+#endif
+}
+
 void affine_background_update()
 {
-    if (REG_IE & IRQ_HBLANK) // High quality mode with HBLANK interrupt
+    bool per_scanline = per_scanline_requested && quality_get_tier() < QUALITY_TIER_FLAT_BACKGROUND;
+    if (per_scanline != per_scanline_enabled)
+    {
+        affine_background_set_per_scanline(per_scanline);
+    }
+
+    if (per_scanline_enabled) // High quality mode, rows are applied during HBLANK
     {
         affine_background_prep_bgaff_arr();
     }
-    else // Low quality mode without HBLANK interrupt
+    else // Low quality mode with one transform per frame
     {
         asx.scr_x = 0;
         asx.scr_y = 0;
@@ -90,16 +178,14 @@ void affine_background_update()
 
 void affine_background_set_color(COLOR color)
 {
-    affine_background_change_background(background); // Reload the palette to reset any previous color scaling
-    for (int i = 0; i < AFFINE_BG_PAL_LEN; i++)
-    {
-        clr_rgbscale(&pal_bg_mem[AFFINE_BG_PB] + i, &pal_bg_mem[AFFINE_BG_PB] + i, 1, color);
-    }
+    // Scaled from the loaded palette so any previous color is replaced without reloading the background
+    clr_rgbscale(&pal_bg_shadow[AFFINE_BG_PB], palette_src, AFFINE_BG_PAL_LEN, color);
 }
 
 void affine_background_load_palette(const u16 *src)
 {
-    memcpy16(&pal_bg_mem[AFFINE_BG_PB], src, AFFINE_BG_PAL_LEN);
+    palette_src = src;
+    memcpy16(&pal_bg_shadow[AFFINE_BG_PB], src, AFFINE_BG_PAL_LEN);
 }
 
 void affine_background_change_background(enum AffineBackgroundID new_bg)
@@ -111,7 +197,7 @@ void affine_background_change_background(enum AffineBackgroundID new_bg)
     case AFFINE_BG_MAIN_MENU:
         REG_BG2CNT &= ~BG_AFF_32x32;
         REG_BG2CNT |= BG_AFF_16x16;
-        REG_IE |= IRQ_HBLANK; // Enable HBLANK
+        per_scanline_requested = true; // Takes effect at the next update
 
         memcpy32_tile8_with_palette_offset((u32*)&tile8_mem[AFFINE_BG_CBB], (const u32*)affine_main_menu_background_gfxTiles, affine_main_menu_background_gfxTilesLen/4, AFFINE_BG_PB);
         GRIT_CPY(&se_mem[AFFINE_BG_SBB], affine_main_menu_background_gfxMap);
@@ -120,7 +206,7 @@ void affine_background_change_background(enum AffineBackgroundID new_bg)
     case AFFINE_BG_GAME:
         REG_BG2CNT &= ~BG_AFF_16x16;
         REG_BG2CNT |= BG_AFF_32x32;
-        REG_IE &= ~IRQ_HBLANK; // Disable HBLANK
+        per_scanline_requested = false;
 
         memcpy32_tile8_with_palette_offset((u32*)&tile8_mem[AFFINE_BG_CBB], (const u32*)affine_background_gfxTiles, affine_background_gfxTilesLen/4, AFFINE_BG_PB);
         GRIT_CPY(&se_mem[AFFINE_BG_SBB], affine_background_gfxMap);
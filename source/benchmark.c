@@ -0,0 +1,342 @@
+#ifdef BENCHMARK
+
+#include <tonc.h>
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "game.h"
+#include "joker.h"
+#include "card.h"
+#include "sprite.h"
+#include "util.h"
+#include "affine_background.h"
+#include "graphic_utils.h"
+#include "background_gfx.h"
+#include "background_shop_gfx.h"
+#include "background_blind_select_gfx.h"
+#include "background_main_menu_gfx.h"
+
+#define BENCHMARK_REPEATS 8
+#define BENCHMARK_TEXT_X 8
+#define BENCHMARK_LINE_HEIGHT 10
+#define BENCHMARK_HAND_SIZE 8 // The default hand size
+#define BENCHMARK_MOTION_OFFSET int2fx(64)
+
+// mGBA's debug console, ignored by hardware and other emulators.
+// Lets the results be collected from mgba-headless without reading the screen.
+#define MGBA_DEBUG_ENABLE *(vu16*)0x4FFF780
+#define MGBA_DEBUG_FLAGS *(vu16*)0x4FFF700
+#define MGBA_DEBUG_STRING ((char*)0x4FFF600)
+#define MGBA_DEBUG_STRING_LEN 256
+#define MGBA_DEBUG_ENABLE_REQUEST 0xC0DE
+#define MGBA_DEBUG_ENABLED 0x1DEA
+#define MGBA_LOG_INFO 3
+#define MGBA_LOG_SEND 0x100
+
+static int benchmark_text_y = 8;
+static bool mgba_log_enabled = false;
+
+static void benchmark_print(const char *label, uint cycles)
+{
+    tte_printf("#{P:%d,%d}%s: %u", BENCHMARK_TEXT_X, benchmark_text_y, label, cycles);
+    benchmark_text_y += BENCHMARK_LINE_HEIGHT;
+
+    if (mgba_log_enabled)
+    {
+        snprintf(MGBA_DEBUG_STRING, MGBA_DEBUG_STRING_LEN, "benchmark: %s: %u cycles", label, cycles);
+        MGBA_DEBUG_FLAGS = MGBA_LOG_INFO | MGBA_LOG_SEND;
+    }
+}
+
+// Cycles to score a full played hand with the given number of held jokers.
+// Like in game.c each joker is evaluated once per scored card and once more for the independent phase.
+static uint benchmark_joker_scoring(int num_jokers)
+{
+    Joker held_jokers[MAX_JOKERS_HELD_SIZE];
+    Card scored_cards[MAX_SELECTION_SIZE] =
+    {
+        { HEARTS, ACE }, { CLUBS, KING }, { DIAMONDS, TEN }, { SPADES, FIVE }, { HEARTS, TWO }
+    };
+
+    // Step through the registry so a mix of data driven and custom jokers is held
+    for (int i = 0; i < num_jokers; i++)
+    {
+        held_jokers[i] = (Joker){ .id = (i * 7) % get_joker_registry_size(), .modifier = BASE_EDITION };
+    }
+
+    profile_start();
+
+    for (int repeat = 0; repeat < BENCHMARK_REPEATS; repeat++)
+    {
+        for (int c = 0; c <= MAX_SELECTION_SIZE; c++)
+        {
+            Card *scored_card = (c < MAX_SELECTION_SIZE) ? &scored_cards[c] : NULL;
+            for (int j = 0; j < num_jokers; j++)
+            {
+                joker_get_score_effect(&held_jokers[j], scored_card);
+            }
+        }
+    }
+
+    return profile_stop() / BENCHMARK_REPEATS;
+}
+
+// Cycles per frame to run the hand loop's update over a full 8 card hand.
+// In motion every card starts each frame away from its target, at rest they all sit on it.
+static uint benchmark_hand_physics(bool in_motion)
+{
+    Card cards[BENCHMARK_HAND_SIZE];
+    CardObject *hand[BENCHMARK_HAND_SIZE];
+
+    // The top layers are free while the benchmark runs from the main menu
+    for (int i = 0; i < BENCHMARK_HAND_SIZE; i++)
+    {
+        cards[i] = (Card){ i % NUM_SUITS, i };
+        hand[i] = card_object_new(&cards[i]);
+        card_object_set_sprite(hand[i], MAX_SPRITES - 1 - i);
+        hand[i]->sprite_object.tx = int2fx(i * CARD_SPRITE_SIZE);
+        hand[i]->sprite_object.ty = int2fx(100);
+        hand[i]->sprite_object.x = hand[i]->sprite_object.tx;
+        hand[i]->sprite_object.y = hand[i]->sprite_object.ty;
+        card_object_update(hand[i]);
+    }
+
+    uint cycles = 0;
+    for (int repeat = 0; repeat < BENCHMARK_REPEATS; repeat++)
+    {
+        if (in_motion)
+        {
+            for (int i = 0; i < BENCHMARK_HAND_SIZE; i++)
+            {
+                hand[i]->sprite_object.x = hand[i]->sprite_object.tx + BENCHMARK_MOTION_OFFSET;
+                hand[i]->sprite_object.vx = 0;
+            }
+        }
+
+        // The same batch the hand loop builds
+        SpriteObject *batch[BENCHMARK_HAND_SIZE];
+        for (int i = 0; i < BENCHMARK_HAND_SIZE; i++)
+        {
+            batch[i] = &hand[i]->sprite_object;
+        }
+
+        profile_start();
+        sprite_object_update_batch(batch, BENCHMARK_HAND_SIZE);
+        cycles += profile_stop();
+    }
+
+    for (int i = 0; i < BENCHMARK_HAND_SIZE; i++)
+    {
+        card_object_destroy(&hand[i]);
+    }
+
+    return cycles / BENCHMARK_REPEATS;
+}
+
+// Cycles to compute the matrices of a full hand, which used to happen every frame even at rest
+static uint benchmark_hand_rotscale(void)
+{
+    OBJ_AFFINE aff;
+
+    profile_start();
+    for (int repeat = 0; repeat < BENCHMARK_REPEATS; repeat++)
+    {
+        for (int i = 0; i < BENCHMARK_HAND_SIZE; i++)
+        {
+            obj_aff_rotscale(&aff, FIX_ONE, FIX_ONE, 0);
+        }
+    }
+
+    return profile_stop() / BENCHMARK_REPEATS;
+}
+
+// Cycles to compute the rows of the main menu background for one frame.
+// Either with bg_rotscale_ex() for every scanline, which is how it used to be done,
+// or from the rotation table by affine_background_update().
+static uint benchmark_menu_background(bool rotscale)
+{
+    BG_AFFINE rows[SCREEN_HEIGHT];
+    AFF_SRC_EX src = { .scr_x = SCREEN_WIDTH / 2, .sx = 128, .sy = 128 };
+
+    affine_background_change_background(AFFINE_BG_MAIN_MENU);
+
+    profile_start();
+    for (int repeat = 0; repeat < BENCHMARK_REPEATS; repeat++)
+    {
+        if (rotscale)
+        {
+            for (int vcount = 0; vcount < SCREEN_HEIGHT; vcount++)
+            {
+                src.scr_y = vcount - SCREEN_HEIGHT / 2;
+                src.alpha = vcount << 8;
+                bg_rotscale_ex(&rows[vcount], &src);
+            }
+        }
+        else
+        {
+            affine_background_update();
+        }
+    }
+
+    return profile_stop() / BENCHMARK_REPEATS;
+}
+
+// Cycles to decompress a main background's tiles into VRAM, see main_bg_load() in game.c
+static uint benchmark_main_bg_tiles(const unsigned int *tiles)
+{
+    profile_start();
+    LZ77UnCompVram(tiles, &tile_mem[MAIN_BG_CBB]);
+    return profile_stop();
+}
+
+// Cycles to reverse the stacking order of a full hand.
+// Either by recreating the sprites in the new order, which is how sort_cards() used to do it,
+// or by changing their layers and building the OAM again.
+static uint benchmark_hand_restack(bool recreate)
+{
+    Sprite *sprites[BENCHMARK_HAND_SIZE];
+    const u16 a0 = ATTR0_SQUARE | ATTR0_4BPP | ATTR0_AFF;
+    const int first_layer = MAX_SPRITES - BENCHMARK_HAND_SIZE;
+
+    for (int i = 0; i < BENCHMARK_HAND_SIZE; i++)
+    {
+        sprites[i] = sprite_new(a0, ATTR1_SIZE_32, CARD_TID, 0, first_layer + i); // The palette doesn't matter for the timing
+        sprite_position(sprites[i], i * CARD_SPRITE_SIZE, 100);
+    }
+    sprite_build_oam();
+
+    profile_start();
+    for (int repeat = 0; repeat < BENCHMARK_REPEATS; repeat++)
+    {
+        // Alternate between the two orders so every repeat moves all the sprites
+        bool reversed = repeat % 2 == 0;
+
+        if (recreate)
+        {
+            for (int i = 0; i < BENCHMARK_HAND_SIZE; i++)
+            {
+                sprite_destroy(&sprites[i]);
+            }
+
+            for (int i = 0; i < BENCHMARK_HAND_SIZE; i++)
+            {
+                int layer = first_layer + (reversed ? BENCHMARK_HAND_SIZE - 1 - i : i);
+                sprites[i] = sprite_new(a0, ATTR1_SIZE_32, CARD_TID, 0, layer);
+                sprite_position(sprites[i], i * CARD_SPRITE_SIZE, 100);
+            }
+        }
+        else
+        {
+            for (int i = 0; i < BENCHMARK_HAND_SIZE; i++)
+            {
+                sprite_set_layer(sprites[i], first_layer + (reversed ? BENCHMARK_HAND_SIZE - 1 - i : i));
+            }
+        }
+
+        sprite_build_oam();
+    }
+    uint cycles = profile_stop() / BENCHMARK_REPEATS;
+
+    for (int i = 0; i < BENCHMARK_HAND_SIZE; i++)
+    {
+        sprite_destroy(&sprites[i]);
+    }
+    sprite_build_oam();
+
+    return cycles;
+}
+
+// Cycles to copy all of OAM on the CPU, which is how sprite_draw() used to upload it every frame.
+// The current OAM is copied back onto itself so the screen doesn't change.
+static uint benchmark_oam_full_copy(void)
+{
+    static OBJ_ATTR oam_copy_src[MAX_SPRITES] ALIGN4;
+    memcpy32(oam_copy_src, oam_mem, MAX_SPRITES * sizeof(OBJ_ATTR) / sizeof(u32));
+
+    profile_start();
+    for (int repeat = 0; repeat < BENCHMARK_REPEATS; repeat++)
+    {
+        obj_aff_copy(obj_aff_mem, (const OBJ_AFFINE*)oam_copy_src, MAX_SPRITES * sizeof(OBJ_ATTR) / sizeof(OBJ_AFFINE));
+        oam_copy(oam_mem, oam_copy_src, MAX_SPRITES);
+    }
+
+    return profile_stop() / BENCHMARK_REPEATS;
+}
+
+// Cycles to build and upload OAM for a frame where num_moving of a full hand's sprites moved.
+// With 0 nothing changed and the upload has nothing to copy.
+static uint benchmark_oam_upload(int num_moving)
+{
+    Sprite *sprites[BENCHMARK_HAND_SIZE];
+    const u16 a0 = ATTR0_SQUARE | ATTR0_4BPP;
+    const int first_layer = MAX_SPRITES - BENCHMARK_HAND_SIZE;
+
+    for (int i = 0; i < BENCHMARK_HAND_SIZE; i++)
+    {
+        sprites[i] = sprite_new(a0, ATTR1_SIZE_32, CARD_TID, 0, first_layer + i);
+        sprite_position(sprites[i], i * CARD_SPRITE_SIZE, 100);
+    }
+    sprite_build_oam();
+    sprite_draw();
+
+    uint cycles = 0;
+    for (int repeat = 0; repeat < BENCHMARK_REPEATS; repeat++)
+    {
+        for (int i = 0; i < num_moving; i++)
+        {
+            sprite_position(sprites[i], i * CARD_SPRITE_SIZE, 100 + (repeat % 2));
+        }
+
+        profile_start();
+        sprite_build_oam();
+        sprite_draw();
+        cycles += profile_stop();
+    }
+
+    for (int i = 0; i < BENCHMARK_HAND_SIZE; i++)
+    {
+        sprite_destroy(&sprites[i]);
+    }
+    sprite_build_oam();
+    sprite_draw();
+
+    return cycles / BENCHMARK_REPEATS;
+}
+
+void benchmark_run(void)
+{
+    tte_erase_screen();
+
+    MGBA_DEBUG_ENABLE = MGBA_DEBUG_ENABLE_REQUEST;
+    mgba_log_enabled = MGBA_DEBUG_ENABLE == MGBA_DEBUG_ENABLED;
+
+    const int joker_counts[] = { DEFAULT_JOKER_SLOTS, 10, MAX_JOKERS_HELD_SIZE };
+    for (int i = 0; i < NUM_ELEM_IN_ARR(joker_counts); i++)
+    {
+        char label[32];
+        snprintf(label, sizeof(label), "Score, %d jokers", joker_counts[i]);
+        benchmark_print(label, benchmark_joker_scoring(joker_counts[i]));
+    }
+
+    benchmark_print("OAM, full copy", benchmark_oam_full_copy());
+    benchmark_print("OAM, settled", benchmark_oam_upload(0));
+    benchmark_print("OAM, hand moving", benchmark_oam_upload(BENCHMARK_HAND_SIZE));
+    benchmark_print("Hand physics, at rest", benchmark_hand_physics(false));
+    benchmark_print("Hand physics, in motion", benchmark_hand_physics(true));
+    benchmark_print("Hand rotscale", benchmark_hand_rotscale());
+    benchmark_print("Restack, recreate", benchmark_hand_restack(true));
+    benchmark_print("Restack, layers", benchmark_hand_restack(false));
+    benchmark_print("Menu bg, rotscale", benchmark_menu_background(true));
+    benchmark_print("Menu bg, table", benchmark_menu_background(false));
+    benchmark_print("LZ77 tiles, game bg", benchmark_main_bg_tiles(background_gfxTiles));
+    benchmark_print("LZ77 tiles, shop bg", benchmark_main_bg_tiles(background_shop_gfxTiles));
+    benchmark_print("LZ77 tiles, blinds bg", benchmark_main_bg_tiles(background_blind_select_gfxTiles));
+    benchmark_print("LZ77 tiles, menu bg", benchmark_main_bg_tiles(background_main_menu_gfxTiles));
+
+    while (true)
+    {
+        VBlankIntrWait();
+    }
+}
+
+#endif // BENCHMARK
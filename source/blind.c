@@ -5,6 +5,8 @@
 #include "big_blind_gfx.h"
 #include "boss_blind_gfx.h"
 #include "graphic_utils.h"
+#include "pal_bank.h"
+#include "util.h"
 
 // +1 is added because we'll actually be indexing at 1, but if something causes you to go to ante 0, there will still be a value there.
 static const int ante_lut[MAX_ANTE + 1] = {100, 300, 800, 2000, 5000, 11000, 20000, 35000, 50000};
@@ -25,7 +27,7 @@ static Blind _blind_type_map[BLIND_TYPE_MAX] =
             .tiles = name##_blind_gfxTiles,              \
             .palette = name##_blind_token_palette,       \
             .tid = NAME##_BLIND_TID,                     \
-            .pb = NAME##_BLIND_PB,                       \
+            .pb = UNDEFINED,                             \
         },                                               \
         .score_req_multipler = multi ,                   \
         .reward = _reward ,                              \
@@ -41,7 +43,11 @@ static void blind_gfx_init(enum BlindType type)
     //GRIT_CPY(&tile_mem[4][_blind_type_map[type].pal_info.tid], tiles);
     BlindGfxInfo* p_gfx = &_blind_type_map[type].gfx_info;
     memcpy32(&tile_mem[4][p_gfx->tid], p_gfx->tiles, BLIND_SPRITE_COPY_SIZE);
-    memcpy16(&pal_obj_bank[p_gfx->pb], p_gfx->palette, PAL_ROW_LEN);
+    if (p_gfx->pb != UNDEFINED)
+    {
+        pal_bank_release(PAL_BANK_OBJ, p_gfx->pb);
+    }
+    p_gfx->pb = pal_bank_acquire(PAL_BANK_OBJ, p_gfx->palette, PAL_BANK_VARIANT_PLAIN, NULL);
 }
 
 
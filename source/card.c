@@ -4,24 +4,154 @@
 #include <stdlib.h>
 
 #include "deck_gfx.h"
+#include "game.h"
 #include "graphic_utils.h"
+#include "util.h"
 
 // Audio
 #include "soundbank.h"
 
 #include "pool.h"
+#include "vram_queue.h"
+#include "pal_bank.h"
 
 // Card sprites lookup table. First index is the suit, second index is the rank. The value is the tile index.
-const static u16 card_sprite_lut[NUM_SUITS][NUM_RANKS] = {
-    {0, 16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176, 192},
-    {208, 224, 240, 256, 272, 288, 304, 320, 336, 352, 368, 384, 400},
-    {416, 432, 448, 464, 480, 496, 512, 528, 544, 560, 576, 592, 608},
-    {624, 640, 656, 672, 688, 704, 720, 736, 752, 768, 784, 800, 816}
-};
+// The deck sheet is tile reduced by grit and its map gives the tiles of each face.
+// Faces are 4x4 tiles, laid out by rank across and by suit down.
+#define CARD_TILES_PER_ROW 4
+#define DECK_GFX_MAP_WIDTH (NUM_RANKS * CARD_TILES_PER_ROW)
+
+// Card faces are cached in the VRAM before the joker tiles, where each card layer used to have its own tiles
+#define CARD_TILE_CACHE_SLOTS (MAX_HAND_SIZE + MAX_SELECTION_SIZE)
+#define CARD_FACE(suit, rank) ((suit) * NUM_RANKS + (rank))
+
+// Refcounted cache of the card faces in VRAM, so a face is uploaded once no matter how many
+// times the card is re-layered or how many card objects show it.
+// Faces no longer in use stay resident until their slot is needed, least recently used first.
+static int card_face_slot[MAX_CARDS];
+static int card_slot_face[CARD_TILE_CACHE_SLOTS];
+static int card_slot_num_users[CARD_TILE_CACHE_SLOTS] = { 0 };
+static uint card_slot_last_used[CARD_TILE_CACHE_SLOTS] = { 0 };
+static u32 card_slot_upload_ticket[CARD_TILE_CACHE_SLOTS] = { 0 };
+static uint card_tile_cache_clock = 0;
+
+static int card_pb = 0; // Shared by all the cards
+static uint card_tile_upload_bytes = 0;
+// The faces are put back together here and uploaded from it, one per slot
+EWRAM_BSS static TILE card_slot_tiles[CARD_TILE_CACHE_SLOTS][CARD_SPRITE_OFFSET];
+
+static int card_slot_get_tile_index(int slot)
+{
+    return CARD_TID + slot * CARD_SPRITE_OFFSET;
+}
+
+static int card_tile_cache_find_free_slot()
+{
+    int lru_slot = UNDEFINED;
+    for (int i = 0; i < CARD_TILE_CACHE_SLOTS; i++)
+    {
+        if (card_slot_face[i] == UNDEFINED)
+        {
+            return i;
+        }
+
+        if (card_slot_num_users[i] == 0 
+            && (lru_slot == UNDEFINED || card_slot_last_used[i] < card_slot_last_used[lru_slot]))
+        {
+            lru_slot = i;
+        }
+    }
+
+    return lru_slot;
+}
+
+static void card_face_get_tiles(Card *card, TILE *tiles)
+{
+    const TILE *deck_tiles = (const TILE *)deck_gfxTiles;
+    const u16 *face_map = &deck_gfxMap[card->suit * CARD_TILES_PER_ROW * DECK_GFX_MAP_WIDTH + card->rank * CARD_TILES_PER_ROW];
+
+    for (int y = 0; y < CARD_TILES_PER_ROW; y++)
+    {
+        for (int x = 0; x < CARD_TILES_PER_ROW; x++)
+        {
+            *tiles++ = deck_tiles[face_map[y * DECK_GFX_MAP_WIDTH + x] & SE_ID_MASK];
+        }
+    }
+}
+
+static int card_tile_cache_acquire(Card *card)
+{
+    int face = CARD_FACE(card->suit, card->rank);
+    int slot = card_face_slot[face];
+
+    if (slot == UNDEFINED)
+    {
+        slot = card_tile_cache_find_free_slot();
+        if (slot == UNDEFINED)
+        {
+            // There are more slots than card objects so this shouldn't happen
+            return CARD_TID;
+        }
+
+        if (card_slot_face[slot] != UNDEFINED)
+        {
+            card_face_slot[card_slot_face[slot]] = UNDEFINED; // Evict
+        }
+
+        card_slot_face[slot] = face;
+        card_face_slot[face] = slot;
+
+        // An upload of the previous face still in the queue copies the new one instead, which is fine
+        card_face_get_tiles(card, card_slot_tiles[slot]);
+        card_slot_upload_ticket[slot] = vram_queue_push(&tile_mem[4][card_slot_get_tile_index(slot)], card_slot_tiles[slot], sizeof(card_slot_tiles[slot]));
+        card_tile_upload_bytes += TILE_SIZE * CARD_SPRITE_OFFSET * sizeof(u32);
+    }
+
+    card_slot_num_users[slot]++;
+
+    return card_slot_get_tile_index(slot);
+}
+
+// Cards sharing a face also wait for its upload
+static u32 card_tile_cache_get_upload_ticket(int tile_index)
+{
+    return card_slot_upload_ticket[(tile_index - CARD_TID) / CARD_SPRITE_OFFSET];
+}
+
+static void card_tile_cache_release(int tile_index)
+{
+    int slot = (tile_index - CARD_TID) / CARD_SPRITE_OFFSET;
+    if (slot < 0 || slot >= CARD_TILE_CACHE_SLOTS || card_slot_num_users[slot] == 0)
+        return;
+
+    card_slot_num_users[slot]--;
+    card_slot_last_used[slot] = ++card_tile_cache_clock;
+}
 
 void card_init()
 {
-    GRIT_CPY(&pal_obj_mem[CARD_PB], deck_gfxPal);
+    // Every card shares this one, it's never released
+    card_pb = pal_bank_acquire(PAL_BANK_OBJ, deck_gfxPal, PAL_BANK_VARIANT_PLAIN, NULL);
+
+    for (int i = 0; i < MAX_CARDS; i++)
+    {
+        card_face_slot[i] = UNDEFINED;
+    }
+
+    for (int i = 0; i < CARD_TILE_CACHE_SLOTS; i++)
+    {
+        card_slot_face[i] = UNDEFINED;
+    }
+}
+
+uint card_get_tile_upload_bytes()
+{
+    return card_tile_upload_bytes;
+}
+
+void card_reset_tile_upload_bytes()
+{
+    card_tile_upload_bytes = 0;
 }
 
 // Card methods
@@ -65,7 +195,8 @@ CardObject *card_object_new(Card *card)
     CardObject *card_object = POOL_GET(CardObject);
 
     card_object->card = card;
-    card_object->sprite_object = sprite_object_new();
+    sprite_object_init(&card_object->sprite_object);
+    card_object->tile_index = UNDEFINED;
 
     return card_object;
 }
@@ -73,7 +204,11 @@ CardObject *card_object_new(Card *card)
 void card_object_destroy(CardObject **card_object)
 {
     if (*card_object == NULL) return;
-    sprite_object_destroy(&((*card_object)->sprite_object));
+    if ((*card_object)->tile_index != UNDEFINED)
+    {
+        card_tile_cache_release((*card_object)->tile_index);
+    }
+    sprite_object_deinit(&(*card_object)->sprite_object);
     POOL_FREE(CardObject, *card_object);
     *card_object = NULL;
 }
@@ -81,38 +216,46 @@ void card_object_destroy(CardObject **card_object)
 void card_object_update(CardObject* card_object)
 {
     if (card_object == NULL) return;
-    sprite_object_update(card_object->sprite_object);
+    sprite_object_update(&card_object->sprite_object);
 }
 
 void card_object_set_sprite(CardObject *card_object, int layer)
 {
-    int tile_index = CARD_TID + (layer * CARD_SPRITE_OFFSET);
-    memcpy32(&tile_mem[4][tile_index], &deck_gfxTiles[card_sprite_lut[card_object->card->suit][card_object->card->rank] * TILE_SIZE], TILE_SIZE * CARD_SPRITE_OFFSET);
-    sprite_object_set_sprite(card_object->sprite_object, sprite_new(ATTR0_SQUARE | ATTR0_4BPP | ATTR0_AFF, ATTR1_SIZE_32, tile_index, 0, layer + CARD_STARTING_LAYER));
+    if (card_object->tile_index == UNDEFINED)
+    {
+        card_object->tile_index = card_tile_cache_acquire(card_object->card);
+    }
+
+    Sprite *sprite = sprite_new(ATTR0_SQUARE | ATTR0_4BPP | ATTR0_AFF, ATTR1_SIZE_32, card_object->tile_index, card_pb, layer + CARD_STARTING_LAYER);
+    if (sprite != NULL)
+    {
+        sprite_set_upload_ticket(sprite, card_tile_cache_get_upload_ticket(card_object->tile_index));
+    }
+    sprite_object_set_sprite(&card_object->sprite_object, sprite);
 }
 
 void card_object_shake(CardObject* card_object, mm_word sound_id)
 {
-    sprite_object_shake(card_object->sprite_object, sound_id);
+    sprite_object_shake(&card_object->sprite_object, sound_id);
 }
 
 void card_object_set_selected(CardObject* card_object, bool selected)
 {
     if (card_object == NULL)
         return;
-    sprite_object_set_selected(card_object->sprite_object, selected);
+    sprite_object_set_selected(&card_object->sprite_object, selected);
 }
 
 bool card_object_is_selected(CardObject* card_object)
 {
     if (card_object == NULL)
         return false;
-    return sprite_object_is_selected(card_object->sprite_object);
+    return sprite_object_is_selected(&card_object->sprite_object);
 }
 
 Sprite* card_object_get_sprite(CardObject* card_object)
 {
     if (card_object == NULL)
         return NULL;
-    return sprite_object_get_sprite(card_object->sprite_object);
+    return sprite_object_get_sprite(&card_object->sprite_object);
 }
@@ -3,16 +3,20 @@
 #include <maxmod.h>
 #include <tonc.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "tonc_memdef.h"
 #include "util.h"
 #include "sprite.h"
+#include "tween.h"
 #include "card.h"
 #include "hand_analysis.h"
 #include "blind.h"
 #include "joker.h"
 #include "affine_background.h"
 #include "graphic_utils.h"
+#include "pal_bank.h"
+#include "pal_fx.h"
 #include "audio_utils.h"
 #include "selection_grid.h"
 #include "splash_screen.h"
@@ -84,10 +88,13 @@ static void game_main_menu_on_init();
 static void game_main_menu_on_update();
 static void game_round_on_init();
 static void game_playing_on_update();
+static void game_round_end_on_init();
 static void game_round_end_on_update();
 static void game_round_end_on_exit();
+static void game_shop_on_init();
 static void game_shop_on_update();
 static void game_shop_on_exit();
+static void game_blind_select_on_init();
 static void game_blind_select_on_update();
 static void game_blind_select_on_exit();
 static void game_lose_on_init();
@@ -118,6 +125,29 @@ static uint timer = 0; // This might already exist in libtonc but idk so i'm jus
 static int game_speed = 1; // BY DEFAULT IS SET TO 1, but if changed to 2 or more, should speed up all (or most) of the game aspects that should be sped up by speed, as in the original game.
 static int background = 0;
 
+// The graphics of a main background, as converted by grit.
+// The tiles are LZ77 compressed (-gzl), the map and palette aren't since they're partially copied and patched.
+typedef struct
+{
+    const unsigned short *pal;
+    uint pal_len;
+    const unsigned int *tiles;
+    const unsigned short *map;
+    uint map_len;
+} MainBgGfx;
+
+#define MAIN_BG_GFX(name) { name##Pal, name##PalLen, name##Tiles, name##Map, name##MapLen }
+#define LZ77_DECOMPRESSED_SIZE(data) ((data)[0] >> 8) // The header word is the size << 8 | 0x10
+
+static const MainBgGfx main_bg_gfx_game = MAIN_BG_GFX(background_gfx);
+static const MainBgGfx main_bg_gfx_shop = MAIN_BG_GFX(background_shop_gfx);
+static const MainBgGfx main_bg_gfx_blind_select = MAIN_BG_GFX(background_blind_select_gfx);
+static const MainBgGfx main_bg_gfx_main_menu = MAIN_BG_GFX(background_main_menu_gfx);
+
+static const MainBgGfx *main_bg_resident_gfx = NULL; // Whose tiles are in MAIN_BG_CBB
+static int main_bg_upload_bytes = 0; // Of the last background change
+static bool main_bg_pal_pending = false; // The new tiles are already showing, their colors aren't
+
 static StateInfo state_info[] = 
 {
 #define DEF_STATE_INFO(stateEnum, init_fn, update_fn, exit_fn) \
@@ -211,6 +241,10 @@ static int mult = 0;
 
 static int hand_size = 8; // Default hand size is 8
 static int cards_drawn = 0;
+// The cards of the current draw in the order they left the deck, the first cards_drawn of them have been sent in
+static CardObject *pending_draws[MAX_HAND_SIZE] = {NULL};
+static int num_pending_draws = 0;
+static bool draw_in_progress = false;
 static int hand_selections = 0;
 
 static int selection_x = 0;
@@ -222,6 +256,14 @@ static List *jokers = NULL;
 static List *discarded_jokers = NULL;
 static List *jokers_available_to_shop; // List of joker IDs
 
+// How many of each joker ID is held, so ownership checks don't need to walk the jokers list
+static u8 held_joker_counts[MAX_DEFINABLE_JOKERS] = {0};
+static int num_negative_jokers_held = 0;
+static int bonus_joker_slots = 0; // From vouchers such as Antimatter, once they're added
+
+// Index of the next held joker to be scored, so each joker is only evaluated once per scored card
+static int scoring_joker_idx = 0;
+
 // Stacks
 static CardObject *played[MAX_SELECTION_SIZE] = {NULL};
 static int played_top = -1;
@@ -235,6 +277,27 @@ static int deck_top = -1;
 static Card *discard_pile[MAX_DECK_SIZE] = {NULL};
 static int discard_top = -1;
 
+// The objects moved by one of the update loops are integrated together once the loop is done
+static SpriteObject *sprite_object_batch[MAX_HAND_SIZE + MAX_ACTIVE_JOKERS];
+static int sprite_object_batch_size = 0;
+
+static void sprite_object_batch_flush()
+{
+    if (sprite_object_batch_size == 0) return;
+    sprite_object_update_batch(sprite_object_batch, sprite_object_batch_size);
+    sprite_object_batch_size = 0;
+}
+
+static void sprite_object_batch_add(SpriteObject *sprite_object)
+{
+    if (sprite_object_batch_size >= NUM_ELEM_IN_ARR(sprite_object_batch))
+    {
+        sprite_object_batch_flush();
+    }
+
+    sprite_object_batch[sprite_object_batch_size++] = sprite_object;
+}
+
 // Played stack
 static inline void played_push(CardObject *card_object)
 {
@@ -280,12 +343,12 @@ static inline void reset_top_left_panel_bottom_row()
 {
     int y = 6;
 
-    memset16(&se_mem[MAIN_BG_SBB][32 * (y - 1)], 0x0006, 1);
-    memset16(&se_mem[MAIN_BG_SBB][1 + 32 * (y - 1)], 0x0007, 2);
-    memset16(&se_mem[MAIN_BG_SBB][3 + 32 * (y - 1)], 0x0008, 1);
-    memset16(&se_mem[MAIN_BG_SBB][4 + 32 * (y - 1)], 0x0009, 3);
-    memset16(&se_mem[MAIN_BG_SBB][7 + 32 * (y - 1)], 0x000A, 1);
-    memset16(&se_mem[MAIN_BG_SBB][8 + 32 * (y - 1)], 0x0406, 1);
+    memset16(&main_bg_se_edit_row(y - 1)[0], 0x0006, 1);
+    memset16(&main_bg_se_edit_row(y - 1)[1], 0x0007, 2);
+    memset16(&main_bg_se_edit_row(y - 1)[3], 0x0008, 1);
+    memset16(&main_bg_se_edit_row(y - 1)[4], 0x0009, 3);
+    memset16(&main_bg_se_edit_row(y - 1)[7], 0x000A, 1);
+    memset16(&main_bg_se_edit_row(y - 1)[8], 0x0406, 1);
 }
 
 // get-functions, for other files to view game state (mainly for jokers)
@@ -315,24 +378,45 @@ List *get_jokers(void) {
 }
 
 bool is_joker_owned(int joker_id) {
-    for (int k = 0; k < list_get_size(jokers); k++)
-    {
-        JokerObject *joker = list_get(jokers, k);
-        if (joker->joker->id == joker_id)
-        {
-            return true;
-        }
-    }
-    return false;
+    if (joker_id < 0 || joker_id >= MAX_DEFINABLE_JOKERS)
+        return false;
+    return held_joker_counts[joker_id] > 0;
+}
+
+// Negative jokers bring their own slot
+int get_joker_slots(void)
+{
+    return min(DEFAULT_JOKER_SLOTS + bonus_joker_slots + num_negative_jokers_held, MAX_JOKERS_HELD_SIZE);
+}
+
+static bool can_hold_joker(const Joker *joker)
+{
+    int num_held = list_get_size(jokers);
+    if (num_held >= MAX_JOKERS_HELD_SIZE)
+        return false;
+
+    return joker->modifier == NEGATIVE_EDITION || num_held < get_joker_slots();
 }
 
 void add_joker(JokerObject *joker_object)
 {
     list_append(jokers, joker_object);
+
+    held_joker_counts[joker_object->joker->id]++;
+    if (joker_object->joker->modifier == NEGATIVE_EDITION)
+        num_negative_jokers_held++;
 }
 
 void remove_held_joker(int joker_idx)
 {
+    JokerObject *joker_object = list_get(jokers, joker_idx);
+    if (joker_object == NULL)
+        return;
+
+    held_joker_counts[joker_object->joker->id]--;
+    if (joker_object->joker->modifier == NEGATIVE_EDITION)
+        num_negative_jokers_held--;
+
     list_remove_by_idx(jokers, joker_idx);
 }
 
@@ -359,6 +443,7 @@ int get_game_speed(void)
 void set_game_speed(int new_game_speed)
 {
     game_speed = new_game_speed;
+    sprite_object_set_game_speed(new_game_speed);
 }
 
 int get_money(void)
@@ -438,6 +523,7 @@ static const Rect GAME_LOSE_MSG_TEXT_RECT   = {104,     72,     UNDEFINED, UNDEF
 static const Rect GAME_WIN_MSG_TEXT_RECT    = {112,      72,     UNDEFINED, UNDEFINED};
 
 static const BG_POINT HELD_JOKERS_POS       = {108,     10};
+static const BG_POINT HELD_JOKER_ICONS_POS  = {184,     12}; // Compact icons go in the consumables panel
 static const BG_POINT JOKER_DISCARD_TARGET  = {240,     30};
 static const BG_POINT CARD_DRAW_POS         = {208,     110};
 static const BG_POINT CUR_BLIND_TOKEN_POS   = {8,       18};
@@ -447,12 +533,28 @@ static const BG_POINT MAIN_MENU_ACE_T       = {88,      26};
 
 #define ITEM_SHOP_Y 71 // TODO: Needs to be a rect?
 
+#define HELD_JOKERS_MAX_SPACING 26
+#define HELD_JOKERS_STRIP_WIDTH 80 // Distance between the leftmost and rightmost held joker
+#define HELD_JOKER_ICONS_PER_ROW 4
+#define HELD_JOKER_ICON_SPACING 11
+
 #define MAIN_MENU_BUTTONS 2
 #define MAIN_MENU_IMPLEMENTED_BUTTONS 1 // Remove this once all buttons are implemented
 
 //TODO: Properly define and use
 #define MENU_POP_OUT_ANIM_FRAMES 20
+#define MENU_POP_IN_ANIM_FRAMES 12
+#define BLIND_SELECTED_ANIM_ROWS 14 // The rest of MENU_POP_OUT_ANIM_FRAMES is a pause
+#define TOP_LEFT_ITEM_ROWS 6 // The height of TOP_LEFT_ITEM_SRC_RECT
 #define GAME_OVER_ANIM_FRAMES 15
+#define ROUND_END_START_WAIT_FRAMES 30 // The played cards leave before the panel comes up
+#define ROUND_END_POP_IN_ANIM_FRAMES 13
+#define ROUND_END_BLIND_ANIM_FRAMES 30 // One row then a pause
+#define ROUND_END_SCORE_MIN_TILES 4
+#define ROUND_END_PANEL_EXIT_ROWS 7
+#define ROUND_END_HAND_REWARD_LINE_FRAMES 30 // From the separator line to the hand reward line
+#define ROUND_END_CASHOUT_WAIT_FRAMES 40
+#define ROUND_END_DISMISS_ANIM_FRAMES 20
 
 #define SCORED_CARD_TEXT_Y 48
 
@@ -461,6 +563,8 @@ static const BG_POINT MAIN_MENU_ACE_T       = {88,      26};
 #define SHOP_LIGHTS_2_CLR 0x32BE
 #define SHOP_LIGHTS_3_CLR 0x4B5F
 #define SHOP_LIGHTS_4_CLR 0x5F9F
+#define SHOP_LIGHTS_CYCLE_FRAMES 20
+#define GAME_RESTART_FADE_FRAMES 20
 
 #define PITCH_STEP_DISCARD_SFX      (-64)
 #define PITCH_STEP_DRAW_SFX         24
@@ -480,23 +584,12 @@ static const BG_POINT MAIN_MENU_ACE_T       = {88,      26};
 
 // Timer defs
 #define TM_ZERO 0
-#define TM_RESET_STATIC_VARS 30
-#define TM_END_POP_MENU_ANIM 13
-#define TM_START_ROUND_END_MENU_AMIN 1
-#define TM_END_DISPLAY_FIN_BLIND 30
-#define TM_END_DISPLAY_SCORE_MIN 4
 #define TM_ELLIPSIS_PRINT_MAX_TM 16
-#define TM_DISPLAY_REWARDS_CONT_WAIT 30
 #define TM_HAND_REWARD_INCR_WAIT 45
-#define TM_DISMISS_ROUND_END_TM 20
-#define TM_CREATE_SHOP_ITEMS_WAIT 1
-#define TM_SHIFT_SHOP_ICON_WAIT 7
-#define TM_END_GAME_SHOP_INTRO 12
 #define TM_SHOP_PRC_INPUT_START 1
-#define TM_DISP_BLIND_PANEL_FINISH 7
-#define TM_DISP_BLIND_PANEL_START 1
 #define TM_BLIND_SELECT_START 1
-#define TM_END_ANIM_SEQ 12
+
+#define JOKER_DISCARD_ANIM_FRAMES 20
 
 // Palette IDs
 #define PLAY_HAND_BTN_SELECTED_BORDER_PID 1
@@ -526,6 +619,10 @@ static const BG_POINT MAIN_MENU_ACE_T       = {88,      26};
 #define SHOP_LIGHTS_4_PID 22
 #define SHOP_BOTTOM_PANEL_BORDER_PID 26
 
+// The lights around the shop icon, each one takes the color of the one before it
+static const u8 shop_lights_pids[] = { SHOP_LIGHTS_2_PID, SHOP_LIGHTS_3_PID, SHOP_LIGHTS_4_PID, SHOP_LIGHTS_1_PID };
+static int shop_lights_cycle = UNDEFINED;
+
 
 // Naming the stage where cards return from the discard pile to the deck "undiscard"
 
@@ -568,8 +665,33 @@ void sort_hand_by_rank()
     }
 }
 
+// Restacks the hand sprites in hand order, the OAM entries are reassigned when it's built.
+// Cards that don't have a sprite yet get one.
+static void hand_restack_sprites()
+{
+    for (int i = 0; i <= hand_top; i++)
+    {
+        if (hand[i] == NULL)
+            continue;
+
+        Sprite *sprite = card_object_get_sprite(hand[i]);
+        if (sprite != NULL)
+        {
+            sprite_set_layer(sprite, CARD_STARTING_LAYER + i);
+        }
+        else // Just drawn
+        {
+            card_object_set_sprite(hand[i], i);
+            sprite_position(card_object_get_sprite(hand[i]), fx2int(hand[i]->sprite_object.x), fx2int(hand[i]->sprite_object.y));
+        }
+    }
+}
+
 void sort_cards()
 {
+    // The hand loop can sort mid way, the cards it already went over move before they change slots
+    sprite_object_batch_flush();
+
     if (sort_by_suit)
     {
         sort_hand_by_suit();
@@ -579,26 +701,7 @@ void sort_cards()
         sort_hand_by_rank();
     }
 
-    // Update the sprites in the hand by destroying them and creating new ones in the correct order
-    // (This is feels like a diabolical solution but like literally how else would you do this)
-    for (int i = 0; i <= hand_top; i++)
-    {
-        if (hand[i] != NULL)
-        {
-            // card_object_get_sprite() will not work here since we need the address
-            sprite_destroy(&(hand[i]->sprite_object->sprite));
-        }
-    }
-
-    for (int i = 0; i <= hand_top; i++)
-    {
-        if (hand[i] != NULL)
-        {
-            //hand[i]->sprite = sprite_new(ATTR0_SQUARE | ATTR0_4BPP | ATTR0_AFF, ATTR1_SIZE_32, card_sprite_lut[hand[i]->card->suit][hand[i]->card->rank], 0, i);
-            card_object_set_sprite(hand[i], i); // Set the sprite for the card object
-            sprite_position(card_object_get_sprite(hand[i]), fx2int(hand[i]->sprite_object->x), fx2int(hand[i]->sprite_object->y));
-        }
-    }
+    hand_restack_sprites();
 }
 
 enum HandType hand_get_type()
@@ -693,6 +796,31 @@ void bg_copy_current_item_to_top_left_panel()
     main_bg_se_copy_rect(TOP_LEFT_ITEM_SRC_RECT, TOP_LEFT_PANEL_POINT);
 }
 
+/* The palette and map are always copied since they're modified after loading,
+ * the tiles never are so they're only copied when they aren't already in VRAM
+ * (e.g. when the blind select background is refreshed after skipping a blind).
+ * The palette only goes to the shadow, change_background() shows it once it's patched.
+ */
+static void main_bg_load(const MainBgGfx *gfx)
+{
+    main_bg_upload_bytes = gfx->pal_len + gfx->map_len;
+
+    memcpy16(pal_bg_shadow, gfx->pal, gfx->pal_len / sizeof(u16));
+    main_bg_pal_pending = true;
+    if (gfx != main_bg_resident_gfx)
+    {
+        LZ77UnCompVram(gfx->tiles, &tile_mem[MAIN_BG_CBB]);
+        main_bg_upload_bytes += LZ77_DECOMPRESSED_SIZE(gfx->tiles);
+        main_bg_resident_gfx = gfx;
+    }
+    main_bg_se_load(gfx->map, gfx->map_len / (SE_ROW_LEN * sizeof(SE)));
+}
+
+int game_get_bg_upload_bytes(void)
+{
+    return main_bg_upload_bytes;
+}
+
 void change_background(int id)
 {
     if (background == id)
@@ -707,7 +835,8 @@ void change_background(int id)
         if (background == BG_ID_CARD_PLAYING)
         {
             int offset = 11;
-            memcpy16(&se_mem[MAIN_BG_SBB][SE_ROW_LEN * offset], &background_gfxMap[SE_ROW_LEN * offset], SE_ROW_LEN * 8);
+            main_bg_se_copy_rows(&background_gfxMap[SE_ROW_LEN * offset], offset, 8);
+            main_bg_upload_bytes = SE_ROW_LEN * 8 * sizeof(SCR_ENTRY);
         }
         else
         {
@@ -715,9 +844,7 @@ void change_background(int id)
             
             // Load the tiles and palette
             // Background
-            GRIT_CPY(pal_bg_mem, background_gfxPal);
-            GRIT_CPY(&tile8_mem[MAIN_BG_CBB], background_gfxTiles); 
-            GRIT_CPY(&se_mem[MAIN_BG_SBB], background_gfxMap);
+            main_bg_load(&main_bg_gfx_game);
 
             if (current_blind == BLIND_TYPE_BIG) // Change text and palette depending on blind type
             {
@@ -733,13 +860,13 @@ void change_background(int id)
             bg_copy_current_item_to_top_left_panel();
 
             // This would change the palette of the background to match the blind, but the backgroun doesn't use the blind token's exact colors so a different approach is required
-            memset16(&pal_bg_mem[BLIND_BG_PRIMARY_PID], blind_get_color(current_blind, BLIND_BACKGROUND_MAIN_COLOR_INDEX), 1);
-            memset16(&pal_bg_mem[BLIND_BG_SECONDARY_PID], blind_get_color(current_blind, BLIND_BACKGROUND_SECONDARY_COLOR_INDEX), 1);
-            memset16(&pal_bg_mem[BLIND_BG_SHADOW_PID], blind_get_color(current_blind, BLIND_BACKGROUND_SHADOW_COLOR_INDEX), 1);
+            memset16(&pal_bg_shadow[BLIND_BG_PRIMARY_PID], blind_get_color(current_blind, BLIND_BACKGROUND_MAIN_COLOR_INDEX), 1);
+            memset16(&pal_bg_shadow[BLIND_BG_SECONDARY_PID], blind_get_color(current_blind, BLIND_BACKGROUND_SECONDARY_COLOR_INDEX), 1);
+            memset16(&pal_bg_shadow[BLIND_BG_SHADOW_PID], blind_get_color(current_blind, BLIND_BACKGROUND_SHADOW_COLOR_INDEX), 1);
 
             // Copy the Play Hand and Discard button colors to their selection highlights
-            memcpy16(&pal_bg_mem[PLAY_HAND_BTN_SELECTED_BORDER_PID], &pal_bg_mem[PLAY_HAND_BTN_PID], 1);
-            memcpy16(&pal_bg_mem[DISCARD_BTN_SELECTED_BORDER_PID], &pal_bg_mem[DISCARD_BTN_PID], 1);
+            memcpy16(&pal_bg_shadow[PLAY_HAND_BTN_SELECTED_BORDER_PID], &pal_bg_shadow[PLAY_HAND_BTN_PID], 1);
+            memcpy16(&pal_bg_shadow[DISCARD_BTN_SELECTED_BORDER_PID], &pal_bg_shadow[DISCARD_BTN_PID], 1);
         }
     }
     else if (id == BG_ID_CARD_PLAYING)
@@ -777,27 +904,26 @@ void change_background(int id)
     {
         toggle_windows(false, true);
 
-        GRIT_CPY(pal_bg_mem, background_shop_gfxPal);
-        GRIT_CPY(&tile_mem[MAIN_BG_CBB], background_shop_gfxTiles);
-        GRIT_CPY(&se_mem[MAIN_BG_SBB], background_shop_gfxMap);
+        main_bg_load(&main_bg_gfx_shop);
 
         // Set the outline colors for the shop background. This is used for the alternate shop palettes when opening packs
-        memset16(&pal_bg_mem[SHOP_BOTTOM_PANEL_BORDER_PID], 0x213D, 1);
-        memset16(&pal_bg_mem[SHOP_PANEL_SHADOW_PID], 0x10B4, 1);
+        memset16(&pal_bg_shadow[SHOP_BOTTOM_PANEL_BORDER_PID], 0x213D, 1);
+        memset16(&pal_bg_shadow[SHOP_PANEL_SHADOW_PID], 0x10B4, 1);
         
-        memset16(&pal_bg_mem[SHOP_LIGHTS_2_PID], SHOP_LIGHTS_2_CLR, 1); // Reset the shop lights to correct colors
-        memset16(&pal_bg_mem[SHOP_LIGHTS_3_PID], SHOP_LIGHTS_3_CLR, 1);
-        memset16(&pal_bg_mem[SHOP_LIGHTS_4_PID], SHOP_LIGHTS_4_CLR, 1);
-        memset16(&pal_bg_mem[SHOP_LIGHTS_1_PID], SHOP_LIGHTS_1_CLR, 1);
+        memset16(&pal_bg_shadow[SHOP_LIGHTS_2_PID], SHOP_LIGHTS_2_CLR, 1); // Reset the shop lights to correct colors
+        memset16(&pal_bg_shadow[SHOP_LIGHTS_3_PID], SHOP_LIGHTS_3_CLR, 1);
+        memset16(&pal_bg_shadow[SHOP_LIGHTS_4_PID], SHOP_LIGHTS_4_CLR, 1);
+        memset16(&pal_bg_shadow[SHOP_LIGHTS_1_PID], SHOP_LIGHTS_1_CLR, 1);
+        shop_lights_cycle = pal_fx_cycle_start(PAL_BANK_BG, shop_lights_pids, NUM_ELEM_IN_ARR(shop_lights_pids), SHOP_LIGHTS_CYCLE_FRAMES);
 
-        memcpy16(&pal_bg_mem[REROLL_BTN_SELECTED_BORDER_PID], &pal_bg_mem[REROLL_BTN_PID], 1); // Disable the button highlight colors
-        memcpy16(&pal_bg_mem[NEXT_ROUND_BTN_SELECTED_BORDER_PID], &pal_bg_mem[NEXT_ROUND_BTN_PID], 1); 
+        memcpy16(&pal_bg_shadow[REROLL_BTN_SELECTED_BORDER_PID], &pal_bg_shadow[REROLL_BTN_PID], 1); // Disable the button highlight colors
+        memcpy16(&pal_bg_shadow[NEXT_ROUND_BTN_SELECTED_BORDER_PID], &pal_bg_shadow[NEXT_ROUND_BTN_PID], 1); 
     }
     else if (id == BG_ID_BLIND_SELECT)
     {
         for(int i = 0; i < BLIND_TYPE_MAX; i++)
         {
-            obj_unhide(blind_select_tokens[i]->obj, 0);
+            sprite_unhide(blind_select_tokens[i], 0);
         }
 
         const int default_y = 89 + (TILE_SIZE * 12); // Default y position for the blind select tokens. 12 is the amound of tiles the background is shifted down by
@@ -808,22 +934,20 @@ void change_background(int id)
 
         toggle_windows(false, true);
 
-        GRIT_CPY(pal_bg_mem, background_blind_select_gfxPal);
-        GRIT_CPY(&tile_mem[MAIN_BG_CBB], background_blind_select_gfxTiles);
-        GRIT_CPY(&se_mem[MAIN_BG_SBB], background_blind_select_gfxMap);
+        main_bg_load(&main_bg_gfx_blind_select);
 
         // Copy boss blind colors to blind select palette
-        memset16(&pal_bg_mem[1], blind_get_color(BLIND_TYPE_BOSS, BLIND_BACKGROUND_MAIN_COLOR_INDEX), 1);
-        memset16(&pal_bg_mem[7], blind_get_color(BLIND_TYPE_BOSS, BLIND_BACKGROUND_SHADOW_COLOR_INDEX), 1);
+        memset16(&pal_bg_shadow[1], blind_get_color(BLIND_TYPE_BOSS, BLIND_BACKGROUND_MAIN_COLOR_INDEX), 1);
+        memset16(&pal_bg_shadow[7], blind_get_color(BLIND_TYPE_BOSS, BLIND_BACKGROUND_SHADOW_COLOR_INDEX), 1);
 
         // Disable the button highlight colors
         // Select button PID is 15 and the outline is 18
-        memcpy16(&pal_bg_mem[BLIND_SELECT_BTN_SELECTED_BORDER_PID], &pal_bg_mem[BLIND_SELECT_BTN_PID], 1);
+        memcpy16(&pal_bg_shadow[BLIND_SELECT_BTN_SELECTED_BORDER_PID], &pal_bg_shadow[BLIND_SELECT_BTN_PID], 1);
 		// It seems the skip button (and score multiplier and deck) PB idx is
 		// actually 5, not 10. 10 is the selected border color
 		// Setting this palette value though doesn't seem to have an 
 		// effect.
-        memcpy16(&pal_bg_mem[BLIND_SKIP_BTN_SELECTED_BORDER_PID], &pal_bg_mem[BLIND_SKIP_BTN_PID], 1);
+        memcpy16(&pal_bg_shadow[BLIND_SKIP_BTN_SELECTED_BORDER_PID], &pal_bg_shadow[BLIND_SKIP_BTN_PID], 1);
 
         for (int i = 0; i < BLIND_TYPE_MAX; i++)
         {
@@ -840,7 +964,7 @@ void change_background(int id)
 
                 for (int j = 0; j < BLIND_TYPE_MAX; j++)
                 {
-                    memcpy16(&se_mem[MAIN_BG_SBB][x_to + 32 * y_to], &se_mem[MAIN_BG_SBB][x_from + 32 * y_from], 5);
+                    memcpy16(&main_bg_se_edit_row(y_to)[x_to], &main_bg_se_get_row(y_from)[x_from], 5);
                     y_from++;
                     y_to++;
                 }
@@ -888,7 +1012,7 @@ void change_background(int id)
                     int x_to = 10 + (i * 5);
                     int y_to = 20;
 
-                    memcpy16(&se_mem[MAIN_BG_SBB][x_to + 32 * y_to], &se_mem[MAIN_BG_SBB][x_from + 32 * y_from], 3);
+                    memcpy16(&main_bg_se_edit_row(y_to)[x_to], &main_bg_se_get_row(y_from)[x_from], 3);
                     break;
                 }
                 case BLIND_STATE_SKIPPED: // Change the select icon to "SKIP"
@@ -899,7 +1023,7 @@ void change_background(int id)
                     int x_to = 10 + (i * 5);
                     int y_to = 20;
 
-                    memcpy16(&se_mem[MAIN_BG_SBB][x_to + 32 * y_to], &se_mem[MAIN_BG_SBB][x_from + 32 * y_from], 3);
+                    memcpy16(&main_bg_se_edit_row(y_to)[x_to], &main_bg_se_get_row(y_from)[x_from], 3);
                     break;
                 }
                 case BLIND_STATE_DEFEATED: // Change the select icon to "DEFEATED"
@@ -910,7 +1034,7 @@ void change_background(int id)
                     int x_to = 10 + (i * 5);
                     int y_to = 20;
 
-                    memcpy16(&se_mem[MAIN_BG_SBB][x_to + 32 * y_to], &se_mem[MAIN_BG_SBB][x_from + 32 * y_from], 3);
+                    memcpy16(&main_bg_se_edit_row(y_to)[x_to], &main_bg_se_get_row(y_from)[x_from], 3);
                     break;
                 }
                 default:
@@ -923,12 +1047,10 @@ void change_background(int id)
         toggle_windows(false, false);
 
         tte_erase_screen();
-        GRIT_CPY(pal_bg_mem, background_main_menu_gfxPal);
-        GRIT_CPY(&tile_mem[MAIN_BG_CBB], background_main_menu_gfxTiles);
-        GRIT_CPY(&se_mem[MAIN_BG_SBB], background_main_menu_gfxMap);
+        main_bg_load(&main_bg_gfx_main_menu);
 
         // Disable the button highlight colors
-        memcpy16(&pal_bg_mem[MAIN_MENU_PLAY_BUTTON_OUTLINE_PID], &pal_bg_mem[MAIN_MENU_PLAY_BUTTON_MAIN_COLOR_PID], 1);
+        memcpy16(&pal_bg_shadow[MAIN_MENU_PLAY_BUTTON_OUTLINE_PID], &pal_bg_shadow[MAIN_MENU_PLAY_BUTTON_MAIN_COLOR_PID], 1);
     }
     else
     {
@@ -936,6 +1058,14 @@ void change_background(int id)
     }
 
     background = id;
+
+    // The tiles and map were replaced right away, so their colors can't wait for VBlank.
+    // They go through the fade so a fade in from black doesn't flash the new background.
+    if (main_bg_pal_pending)
+    {
+        pal_fx_show_now(PAL_BANK_BG);
+        main_bg_pal_pending = false;
+    }
 }
 
 void display_temp_score(int value)
@@ -1040,23 +1170,87 @@ void set_hand()
     display_mult(mult);
 }
 
-void card_draw()
+// Whether a sorts after b in the current sort order, matches sort_hand_by_suit() and sort_hand_by_rank()
+static bool card_object_sorts_after(const CardObject *a, const CardObject *b)
 {
-    if (deck_top < 0 || hand_top >= hand_size - 1 || hand_top >= MAX_HAND_SIZE - 1) return;
+    if (sort_by_suit && a->card->suit != b->card->suit)
+        return a->card->suit > b->card->suit;
+    return a->card->rank > b->card->rank;
+}
 
-    CardObject *card_object = card_object_new(deck_pop());
+// Draws up to count cards from the deck into the hand in one go.
+// The new cards are merged into the already sorted hand and the hand sprites are restacked once.
+// They wait hidden on the deck until hand_release_drawn_card() sends them in.
+static void hand_draw_cards(int count)
+{
+    count = min(count, deck_top + 1);
+    count = min(count, min(hand_size, MAX_HAND_SIZE) - hand_get_size());
+    count = max(count, 0);
 
     const FIXED deck_x = int2fx(CARD_DRAW_POS.x);
     const FIXED deck_y = int2fx(CARD_DRAW_POS.y);
+    CardObject *drawn[MAX_HAND_SIZE];
 
-    card_object->sprite_object->x = deck_x;
-    card_object->sprite_object->y = deck_y;
+    for (int i = 0; i < count; i++)
+    {
+        CardObject *card_object = card_object_new(deck_pop());
+        card_object->sprite_object.x = deck_x;
+        card_object->sprite_object.y = deck_y;
+        card_object->sprite_object.tx = deck_x;
+        card_object->sprite_object.ty = deck_y;
 
-    hand[++hand_top] = card_object;
+        // They come out of the deck in the order they were popped
+        pending_draws[i] = card_object;
 
-    // Sort the hand after drawing a card
-    sort_cards();
+        // Insertion sort of the few drawn cards
+        int j = i - 1;
+        while (j >= 0 && card_object_sorts_after(drawn[j], card_object))
+        {
+            drawn[j + 1] = drawn[j];
+            j--;
+        }
+        drawn[j + 1] = card_object;
+    }
+    num_pending_draws = count;
+
+    // Merge from the back so nothing in the hand is overwritten before it's moved
+    int hand_idx = hand_top;
+    int drawn_idx = count - 1;
+    hand_top += count;
+    for (int i = hand_top; drawn_idx >= 0; i--)
+    {
+        if (hand_idx >= 0 && card_object_sorts_after(hand[hand_idx], drawn[drawn_idx]))
+        {
+            hand[i] = hand[hand_idx--];
+        }
+        else
+        {
+            hand[i] = drawn[drawn_idx--];
+        }
+    }
+
+    // Creates the sprites of the drawn cards and restacks the rest
+    hand_restack_sprites();
+
+    for (int i = 0; i < count; i++)
+    {
+        sprite_hide(card_object_get_sprite(pending_draws[i]));
+    }
+}
 
+static bool hand_card_is_pending(const CardObject *card_object)
+{
+    for (int i = cards_drawn; i < num_pending_draws; i++)
+    {
+        if (pending_draws[i] == card_object)
+            return true;
+    }
+    return false;
+}
+
+static void hand_release_drawn_card(CardObject *card_object)
+{
+    sprite_unhide(card_object_get_sprite(card_object), ATTR0_AFF);
     play_sfx(SFX_CARD_DRAW, MM_BASE_PITCH_RATE + cards_drawn*PITCH_STEP_DRAW_SFX);
 }
 
@@ -1183,19 +1377,22 @@ static void game_round_on_init()
 {
     hand_state = HAND_DRAW;
     cards_drawn = 0;
+    num_pending_draws = 0;
+    draw_in_progress = false;
     hand_selections = 0;
+    card_reset_tile_upload_bytes(); // Counted per round for the debug stats
 
     playing_blind_token = blind_token_new(current_blind, CUR_BLIND_TOKEN_POS.x, CUR_BLIND_TOKEN_POS.y, MAX_SELECTION_SIZE + MAX_HAND_SIZE + 1); // Create the blind token sprite at the top left corner
     // TODO: Hide blind token and display it after sliding blind rect animation
     //if (playing_blind_token != NULL)
     //{
-    //    obj_hide(playing_blind_token->obj); // Hide the blind token sprite for now
+    //    sprite_hide(playing_blind_token); // Hide the blind token sprite for now
     //}
     round_end_blind_token = blind_token_new(current_blind, 81, 86, MAX_SELECTION_SIZE + MAX_HAND_SIZE + 2); // Create the blind token sprite for round end
 
     if (round_end_blind_token != NULL)
     {
-        obj_hide(round_end_blind_token->obj); // Hide the blind token sprite for now
+        sprite_hide(round_end_blind_token); // Hide the blind token sprite for now
     }
 
     Rect blind_req_text_rect = BLIND_REQ_TEXT_RECT;
@@ -1234,12 +1431,12 @@ static void game_main_menu_on_init()
     change_background(BG_ID_MAIN_MENU);
     main_menu_ace = card_object_new(card_new(SPADES, ACE));
     card_object_set_sprite(main_menu_ace, 0); // Set the sprite for the ace of spades
-    main_menu_ace->sprite_object->sprite->obj->attr0 |= ATTR0_AFF_DBL; // Make the sprite double sized
-    main_menu_ace->sprite_object->tx = int2fx(MAIN_MENU_ACE_T.x);
-    main_menu_ace->sprite_object->x = main_menu_ace->sprite_object->tx;
-    main_menu_ace->sprite_object->ty = int2fx(MAIN_MENU_ACE_T.y);
-    main_menu_ace->sprite_object->y = main_menu_ace->sprite_object->ty;
-    main_menu_ace->sprite_object->tscale = float2fx(0.8f);
+    main_menu_ace->sprite_object.sprite->obj.attr0 |= ATTR0_AFF_DBL; // Make the sprite double sized
+    main_menu_ace->sprite_object.tx = int2fx(MAIN_MENU_ACE_T.x);
+    main_menu_ace->sprite_object.x = main_menu_ace->sprite_object.tx;
+    main_menu_ace->sprite_object.ty = int2fx(MAIN_MENU_ACE_T.y);
+    main_menu_ace->sprite_object.y = main_menu_ace->sprite_object.ty;
+    main_menu_ace->sprite_object.tscale = float2fx(0.8f);
 }
 
 static void game_over_init()
@@ -1301,6 +1498,9 @@ void game_init()
     // Initialize jokers list
     if (jokers) list_destroy(&jokers);
     jokers = list_new(MAX_JOKERS_HELD_SIZE);
+    memset(held_joker_counts, 0, sizeof(held_joker_counts));
+    num_negative_jokers_held = 0;
+    scoring_joker_idx = 0;
 
     if (discarded_jokers != NULL) list_destroy(&discarded_jokers);
     discarded_jokers = list_new(MAX_JOKERS_HELD_SIZE);
@@ -1321,9 +1521,9 @@ void game_init()
     blind_select_tokens[BLIND_TYPE_BIG] = blind_token_new(BLIND_TYPE_BIG, CUR_BLIND_TOKEN_POS.x, CUR_BLIND_TOKEN_POS.y, MAX_SELECTION_SIZE + MAX_HAND_SIZE + 4);
     blind_select_tokens[BLIND_TYPE_BOSS] = blind_token_new(BLIND_TYPE_BOSS, CUR_BLIND_TOKEN_POS.x, CUR_BLIND_TOKEN_POS.y, MAX_SELECTION_SIZE + MAX_HAND_SIZE + 5);
 
-    obj_hide(blind_select_tokens[BLIND_TYPE_SMALL]->obj);
-    obj_hide(blind_select_tokens[BLIND_TYPE_BIG]->obj);
-    obj_hide(blind_select_tokens[BLIND_TYPE_BOSS]->obj);
+    sprite_hide(blind_select_tokens[BLIND_TYPE_SMALL]);
+    sprite_hide(blind_select_tokens[BLIND_TYPE_BIG]);
+    sprite_hide(blind_select_tokens[BLIND_TYPE_BOSS]);
 }
 
 void game_start()
@@ -1416,8 +1616,8 @@ static void game_playing_process_hand_select_input()
     {
         if (discard_button_highlighted == false) // Play button logic
         {
-            memset16(&pal_bg_mem[PLAY_HAND_BTN_SELECTED_BORDER_PID], HIGHLIGHT_COLOR, 1);
-            memcpy16(&pal_bg_mem[DISCARD_BTN_SELECTED_BORDER_PID], &pal_bg_mem[DISCARD_BTN_PID], 1);
+            memset16(&pal_bg_shadow[PLAY_HAND_BTN_SELECTED_BORDER_PID], HIGHLIGHT_COLOR, 1);
+            memcpy16(&pal_bg_shadow[DISCARD_BTN_SELECTED_BORDER_PID], &pal_bg_shadow[DISCARD_BTN_PID], 1);
 
             if (key_hit(SELECT_CARD) && hands > 0 && hand_play())
             {
@@ -1430,8 +1630,8 @@ static void game_playing_process_hand_select_input()
         else // Discard button logic
         {
 			// 7 is score and play hand button color
-            memcpy16(&pal_bg_mem[PLAY_HAND_BTN_SELECTED_BORDER_PID], &pal_bg_mem[PLAY_HAND_BTN_PID], 1);
-            memset16(&pal_bg_mem[DISCARD_BTN_SELECTED_BORDER_PID], HIGHLIGHT_COLOR, 1);
+            memcpy16(&pal_bg_shadow[PLAY_HAND_BTN_SELECTED_BORDER_PID], &pal_bg_shadow[PLAY_HAND_BTN_PID], 1);
+            memset16(&pal_bg_shadow[DISCARD_BTN_SELECTED_BORDER_PID], HIGHLIGHT_COLOR, 1);
 
             if (key_hit(SELECT_CARD) && discards > 0 && hand_discard())
             {
@@ -1446,8 +1646,8 @@ static void game_playing_process_hand_select_input()
     }
     else if (selection_y == 0) // On row of cards
     {
-        memcpy16(&pal_bg_mem[PLAY_HAND_BTN_SELECTED_BORDER_PID], &pal_bg_mem[PLAY_HAND_BTN_PID], 1); // Play button highlight color
-        memcpy16(&pal_bg_mem[DISCARD_BTN_SELECTED_BORDER_PID], &pal_bg_mem[DISCARD_BTN_PID], 1); // Discard button highlight color
+        memcpy16(&pal_bg_shadow[PLAY_HAND_BTN_SELECTED_BORDER_PID], &pal_bg_shadow[PLAY_HAND_BTN_PID], 1); // Play button highlight color
+        memcpy16(&pal_bg_shadow[DISCARD_BTN_SELECTED_BORDER_PID], &pal_bg_shadow[DISCARD_BTN_PID], 1); // Discard button highlight color
         
         if (key_hit(SELECT_CARD))
         {
@@ -1523,18 +1723,29 @@ static void game_playing_process_input_and_state()
 
 static void game_playing_process_card_draw()
 {
-    if (hand_state == HAND_DRAW && cards_drawn < hand_size)
+    if (hand_state != HAND_DRAW)
+        return;
+
+    if (!draw_in_progress)
+    {
+        hand_draw_cards(hand_size - hand_get_size());
+        draw_in_progress = true;
+    }
+
+    if (cards_drawn < num_pending_draws)
     {
-        if (timer % FRAMES(10) == 0) // Draw a card every 10 frames
+        if (timer % FRAMES(10) == 0) // Send a card in from the deck every 10 frames
         {
             cards_drawn++;
-            card_draw();
+            hand_release_drawn_card(pending_draws[cards_drawn - 1]);
         }
     }
-    else if (hand_state == HAND_DRAW)
+    else
     {
         hand_state = HAND_SELECT; // Change the hand state to select after drawing all the cards
         cards_drawn = 0;
+        num_pending_draws = 0;
+        draw_in_progress = false;
         timer = TM_ZERO;
     }
 }
@@ -1584,12 +1795,12 @@ static void game_playing_discarded_cards_loop()
             discarded_card_object = card_object_new(discard_pop());
             //discarded_card_object->sprite = sprite_new(ATTR0_SQUARE | ATTR0_4BPP | ATTR0_AFF, ATTR1_SIZE_32, card_sprite_lut[discarded_card_object->card->suit][discarded_card_object->card->rank], 0, 0);
             card_object_set_sprite(discarded_card_object, 0); // Set the sprite for the discarded card object
-            sprite_object_reset_transform(discarded_card_object->sprite_object);
+            sprite_object_reset_transform(&discarded_card_object->sprite_object);
 
-            discarded_card_object->sprite_object->tx = int2fx(204);
-            discarded_card_object->sprite_object->ty = int2fx(112);
-            discarded_card_object->sprite_object->x = int2fx(240);
-            discarded_card_object->sprite_object->y = int2fx(80);
+            discarded_card_object->sprite_object.tx = int2fx(204);
+            discarded_card_object->sprite_object.ty = int2fx(112);
+            discarded_card_object->sprite_object.x = int2fx(240);
+            discarded_card_object->sprite_object.y = int2fx(80);
 
             card_object_update(discarded_card_object);
         }
@@ -1597,7 +1808,7 @@ static void game_playing_discarded_cards_loop()
         {
             card_object_update(discarded_card_object);
 
-            if (discarded_card_object->sprite_object->y >= discarded_card_object->sprite_object->ty)
+            if (discarded_card_object->sprite_object.y >= discarded_card_object->sprite_object.ty)
             {
                 deck_push(discarded_card_object->card); // Put the card back into the deck
                 card_object_destroy(&discarded_card_object);
@@ -1638,7 +1849,7 @@ void card_in_hand_loop_handle_discard_and_shuffling(int card_idx, bool* discarde
                 *sound_played = true;
             }
 
-            if (hand[card_idx]->sprite_object->x >= *hand_x)
+            if (sprite_object_has_left_screen(&hand[card_idx]->sprite_object))
             {
                 discard_push(hand[card_idx]->card);
                 card_object_destroy(&hand[card_idx]);
@@ -1649,8 +1860,8 @@ void card_in_hand_loop_handle_discard_and_shuffling(int card_idx, bool* discarde
                 *sound_played = false;
                 timer = TM_ZERO;
 
-                *hand_y = hand[card_idx]->sprite_object->y;
-                *hand_x = hand[card_idx]->sprite_object->x;
+                *hand_y = hand[card_idx]->sprite_object.y;
+                *hand_x = hand[card_idx]->sprite_object.x;
             }
 
             *discarded_card = true;
@@ -1716,10 +1927,10 @@ static void cards_in_hand_update_loop(bool* discarded_card, int* played_selectio
                     hand_y -= int2fx(CARD_FOCUSED_SEL_Y);
                 }
 
-                if (i != selection_x && hand[i]->sprite_object->y > hand_y)
+                if (i != selection_x && hand[i]->sprite_object.y > hand_y)
                 {
-                    hand[i]->sprite_object->y = hand_y;
-                    hand[i]->sprite_object->vy = 0;
+                    hand[i]->sprite_object.y = hand_y;
+                    hand[i]->sprite_object.vy = 0;
                 }
 
                 hand_x = hand_x + (int2fx(i) - int2fx(hand_top) / 2) * -HAND_SPACING_LUT[hand_top]; // TODO: Change this later to reference a 2D LUT of positions
@@ -1740,7 +1951,7 @@ static void cards_in_hand_update_loop(bool* discarded_card, int* played_selectio
                 {
                     card_object_set_selected(hand[i], false);
                     played_push(hand[i]);
-                    sprite_destroy(&hand[i]->sprite_object->sprite);
+                    sprite_destroy(&hand[i]->sprite_object.sprite);
                     hand[i] = NULL;
                     sort_cards();
 
@@ -1912,11 +2123,17 @@ static void cards_in_hand_update_loop(bool* discarded_card, int* played_selectio
                 break;
             }
 
-            hand[i]->sprite_object->tx = hand_x;
-            hand[i]->sprite_object->ty = hand_y;
-            card_object_update(hand[i]);
+            // Cards still waiting on the deck keep their place there
+            if (hand_state != HAND_DRAW || !hand_card_is_pending(hand[i]))
+            {
+                hand[i]->sprite_object.tx = hand_x;
+                hand[i]->sprite_object.ty = hand_y;
+            }
+            sprite_object_batch_add(&hand[i]->sprite_object);
         }
     }
+
+    sprite_object_batch_flush();
 }
 
 static void played_cards_update_loop(bool* discarded_card, int* played_selections, bool* sound_played)
@@ -1969,15 +2186,17 @@ static void played_cards_update_loop(bool* discarded_card, int* played_selection
 
                             if (*played_selections > 0)
                             {
-                                for (int k = 0; k < list_get_size(jokers); k++)
+                                // Resume from the joker after the last one that scored instead of starting over
+                                for (; scoring_joker_idx < list_get_size(jokers); scoring_joker_idx++)
                                 {
-                                    JokerObject *joker = list_get(jokers, k);
+                                    JokerObject *joker = list_get(jokers, scoring_joker_idx);
                                     if (joker_object_score(joker, played[*played_selections - 1]->card, &chips, &mult, NULL, &money, NULL)) // NULLs aren't implemented yet
                                     {
                                         display_chips(chips);
                                         display_mult(mult);
                                         display_money(money);
 
+                                        scoring_joker_idx++;
                                         return; 
                                     }
                                 }
@@ -1996,8 +2215,9 @@ static void played_cards_update_loop(bool* discarded_card, int* played_selection
                                             joker->joker->processed = false; // Reset the joker's processed state for the next score
                                         }
                                     }
+                                    scoring_joker_idx = 0;
 
-                                    tte_set_pos(fx2int(played[j]->sprite_object->x) + 8, SCORED_CARD_TEXT_Y); // Offset of 16 pixels to center the text on the card
+                                    tte_set_pos(fx2int(played[j]->sprite_object.x) + 8, SCORED_CARD_TEXT_Y); // Offset of 16 pixels to center the text on the card
                                     tte_set_special(0xD000); // Set text color to blue from background memory
 
                                     // Write the score to a character buffer variable
@@ -2020,20 +2240,21 @@ static void played_cards_update_loop(bool* discarded_card, int* played_selection
                             {
                                 tte_erase_rect_wrapper(PLAYED_CARDS_SCORES_RECT);
 
-                                for (int k = 0; k <= list_get_size(jokers); k++) // Independent joker scoring loop
+                                for (; scoring_joker_idx < list_get_size(jokers); scoring_joker_idx++) // Independent joker scoring loop
                                 {
-                                    JokerObject *joker = list_get(jokers, k);
+                                    JokerObject *joker = list_get(jokers, scoring_joker_idx);
                                     if (joker_object_score(joker, NULL, &chips, &mult, NULL, &money, NULL)) // NULLs aren't implemented yet
                                     {
                                         display_chips(chips);
                                         display_mult(mult);
                                         display_money(money);
 
+                                        scoring_joker_idx++;
                                         return; // Returning was just the easiest way to break out of the loop
                                     }
                                 }
 
-                                for (int k = 0; k <= list_get_size(jokers); k++)
+                                for (int k = 0; k < list_get_size(jokers); k++)
                                 {
                                     JokerObject *joker = list_get(jokers, k);
                                     if (joker != NULL)
@@ -2041,6 +2262,7 @@ static void played_cards_update_loop(bool* discarded_card, int* played_selection
                                         joker->joker->processed = false; // Reset the joker's processed state for the next round
                                     }
                                 }
+                                scoring_joker_idx = 0;
 
                                 play_state = PLAY_ENDING;
                                 timer = TM_ZERO;
@@ -2084,7 +2306,7 @@ static void played_cards_update_loop(bool* discarded_card, int* played_selection
                             *sound_played = true;
                         }
 
-                        if (played[i]->sprite_object->x >= played_x)
+                        if (sprite_object_has_left_screen(&played[i]->sprite_object))
                         {
                             discard_push(played[i]->card); // Push the card to the discard pile
                             card_object_destroy(&played[i]);
@@ -2120,12 +2342,14 @@ static void played_cards_update_loop(bool* discarded_card, int* played_selection
                     break;
             }
 
-            played[i]->sprite_object->tx = played_x;
-            played[i]->sprite_object->ty = played_y;
-            played[i]->sprite_object->tscale = played_scale;
-            card_object_update(played[i]);
+            played[i]->sprite_object.tx = played_x;
+            played[i]->sprite_object.ty = played_y;
+            played[i]->sprite_object.tscale = played_scale;
+            sprite_object_batch_add(&played[i]->sprite_object);
         }
     }
+
+    sprite_object_batch_flush();
 }
 
 static void game_playing_ui_text_update()
@@ -2195,6 +2419,59 @@ static void game_playing_on_update()
     game_playing_ui_text_update();
 }
 
+/* The menus slide in and out one background row per frame. A tween track animates how
+ * many rows a slide has gone through and every frame the rows it went past are moved.
+ * Completion callbacks run after the state update so they move the last rows themselves.
+ */
+typedef struct
+{
+    FIXED rows; // Animated by the track
+    int rows_moved;
+    void (*move_row)(int row); // Called with 1 for the first row
+} PanelSlide;
+
+#define PANEL_SLIDE_KEY(rows, frames) { (rows) << FIX_SHIFT, (frames), EASE_LINEAR }
+
+static PanelSlide menu_slide;
+static PanelSlide shop_icon_slide;
+
+static void panel_slide_update(PanelSlide *slide)
+{
+    // Linear keys land within half a row of the row of each frame
+    int rows = fx2int(slide->rows + FIX_ONE / 2);
+    while (slide->rows_moved < rows)
+    {
+        slide->move_row(++slide->rows_moved);
+    }
+}
+
+static void panel_slide_start(PanelSlide *slide, const TweenKey *keys, int num_keys, void (*move_row)(int row), TweenCallback on_complete)
+{
+    slide->rows = 0;
+    slide->rows_moved = 0;
+    slide->move_row = move_row;
+
+    if (tween_start_track(&slide->rows, keys, num_keys, on_complete, slide) == UNDEFINED)
+    {
+        // No tweens left, skip to the end
+        slide->rows = keys[num_keys - 1].value;
+        if (on_complete != NULL)
+        {
+            on_complete(slide);
+        }
+        else
+        {
+            panel_slide_update(slide);
+        }
+    }
+}
+
+// For slides with nothing to do once they're done but move their last rows
+static void panel_slide_on_complete(void *data)
+{
+    panel_slide_update((PanelSlide *)data);
+}
+
 static void game_round_end_on_exit()
 {
     // Cleanup blind tokens from this round to avoid accumulating 
@@ -2219,232 +2496,312 @@ static void game_round_end_on_update()
     round_end_state_actions[substate]();
 }
 
-static void game_round_end_start()
+static const TweenKey round_end_start_keys[] = { PANEL_SLIDE_KEY(0, ROUND_END_START_WAIT_FRAMES) };
+static const TweenKey round_end_pop_in_keys[] = { PANEL_SLIDE_KEY(ROUND_END_POP_IN_ANIM_FRAMES, ROUND_END_POP_IN_ANIM_FRAMES) };
+static const TweenKey round_end_blind_keys[] =
 {
-    if (timer == TM_RESET_STATIC_VARS) // Reset static variables to default values upon re-entering the round end state
-    {   
-        change_background(BG_ID_ROUND_END); // Change the background to the round end background
-        state_info[game_state].substate = START_EXPAND_POPUP; // Change the state to the next one
-        timer = TM_ZERO; // Reset the timer
-        blind_reward = blind_get_reward(current_blind);
-        hand_reward = hands;
-    }
+    PANEL_SLIDE_KEY(1, 1),
+    PANEL_SLIDE_KEY(1, ROUND_END_BLIND_ANIM_FRAMES - 1)
+};
+static const TweenKey round_end_score_min_keys[] = { PANEL_SLIDE_KEY(ROUND_END_SCORE_MIN_TILES, ROUND_END_SCORE_MIN_TILES) };
+// The separator line, then the hand reward line
+static const TweenKey round_end_rewards_keys[] =
+{
+    PANEL_SLIDE_KEY(1, 1),
+    PANEL_SLIDE_KEY(1, ROUND_END_HAND_REWARD_LINE_FRAMES - 2),
+    PANEL_SLIDE_KEY(2, 1)
+};
+static const TweenKey round_end_dismiss_keys[] = { PANEL_SLIDE_KEY(ROUND_END_DISMISS_ANIM_FRAMES, ROUND_END_DISMISS_ANIM_FRAMES) };
+// These pauses follow the game speed so the keys are set when they start
+static TweenKey round_end_panel_exit_keys[2];
+static TweenKey round_end_cashout_keys[2];
+
+// Expands the black part of the round end panel down by one tile below line top
+static void round_end_menu_expand_line(int top)
+{
+    Rect single_line_rect = ROUND_END_MENU_RECT;
+    single_line_rect.top = top;
+    single_line_rect.bottom = single_line_rect.top + 1;
+    main_bg_se_copy_rect_1_tile_vert(single_line_rect, SE_DOWN);
 }
 
-static void game_round_end_start_expand_popup()
+static void game_round_end_pop_in_move_row(int row)
 {
-    main_bg_se_copy_rect_1_tile_vert(POP_MENU_ANIM_RECT, SE_UP);
-    
-    if (timer == TM_END_POP_MENU_ANIM)
+    main_bg_se_slide_up_step(POP_MENU_ANIM_RECT, row, false);
+
+    if (row == ROUND_END_POP_IN_ANIM_FRAMES)
     {
-        state_info[game_state].substate = DISPLAY_FINISHED_BLIND;
-        timer = TM_ZERO;
+        main_bg_se_slide_up_finish(POP_MENU_ANIM_RECT, row, false);
     }
 }
 
-static void game_round_end_display_finished_blind()
+static void game_round_end_blind_move_row(int row)
 {
-    obj_unhide(round_end_blind_token->obj, 0);
-    
-    int current_ante = ante;
-    if (current_blind == BLIND_TYPE_BOSS) current_ante--; // Beating the boss blind increases the ante, so we need to display the previous ante value
-    
-    Rect blind_req_rect = ROUND_END_BLIND_REQ_RECT;
-    int blind_req = blind_get_requirement(current_blind, current_ante);
-    update_text_rect_to_right_align_num(&blind_req_rect, blind_req, OVERFLOW_RIGHT);
-    
-    tte_printf("#{P:%d,%d; cx:0x%X000}%d", blind_req_rect.left, blind_req_rect.top, TTE_RED_PB, blind_req);
-    
-    if (timer == TM_START_ROUND_END_MENU_AMIN)
-    {
-        Rect single_line_rect = ROUND_END_MENU_RECT;
-        single_line_rect.top = 11;
-        single_line_rect.bottom = single_line_rect.top + 1;
-        main_bg_se_copy_rect_1_tile_vert(single_line_rect, SE_DOWN);
-    }
-    
-    if (timer >= TM_END_DISPLAY_FIN_BLIND)
-    {
-        state_info[game_state].substate = DISPLAY_SCORE_MIN;
-        timer = TM_ZERO;
-    }
+    round_end_menu_expand_line(11);
 }
 
-static void game_round_end_display_score_min()
+// The score minimum panel is copied in one tile per frame
+static void game_round_end_score_min_move_row(int tile)
 {
-    const int timer_offset = timer - 1;
     const int x_from = 0;
     const int y_from = 29;
     const int x_to = 13;
     const int y_to = 11;
-    
-    memcpy16(&se_mem[MAIN_BG_SBB][x_to + timer_offset + 32 * y_to], &se_mem[MAIN_BG_SBB][x_from + timer_offset + 32 * y_from], 1);
-    
-    if (timer >= TM_END_DISPLAY_SCORE_MIN)
-    {
-        state_info[game_state].substate = UPDATE_BLIND_REWARD;
-        timer = TM_ZERO;
-    }
+
+    memcpy16(&main_bg_se_edit_row(y_to)[x_to + tile - 1], &main_bg_se_get_row(y_from)[x_from + tile - 1], 1);
 }
 
-static void game_round_end_update_blind_reward()
+static void game_round_end_panel_exit_move_row(int row)
 {
-    if (timer % FRAMES(20) != 0) return;
-    
-    // TODO: Add sound effect here
-    
-    if (blind_reward > 0)
+    main_bg_se_copy_rect_1_tile_vert(TOP_LEFT_PANEL_ANIM_RECT, SE_UP);
+
+    // TODO: make heads or tails of what's going on here and replace
+    // magic numbers.
+    if (row == 1) // Copied from shop. Feels slightly too niche of a function for me personally to make one.
     {
-        blind_reward--;
-        tte_printf("#{P:%d,%d; cx:0x%X000}$%d", BLIND_REWARD_RECT.left , BLIND_REWARD_RECT.top, TTE_YELLOW_PB, blind_reward);
-        tte_printf("#{P:%d,%d; cx:0x%X000}$%d", ROUND_END_BLIND_REWARD_RECT.left, ROUND_END_BLIND_REWARD_RECT.top, TTE_YELLOW_PB, blind_get_reward(current_blind) - blind_reward);
+        reset_top_left_panel_bottom_row();
     }
-    else if (timer > FRAMES(20))
+    else if (row == 2)
     {
-        tte_erase_rect_wrapper(BLIND_REWARD_RECT);
-        tte_erase_rect_wrapper(BLIND_REQ_TEXT_RECT);
-        obj_hide(playing_blind_token->obj);
-        affine_background_load_palette(affine_background_gfxPal);
-        state_info[game_state].substate = BLIND_PANEL_EXIT;
-        timer = TM_ZERO;
+        int y = 5;
+        memset16(&main_bg_se_edit_row(y - 1)[0], 0x0001, 1);
+        memset16(&main_bg_se_edit_row(y - 1)[1], 0x0002, 7);
+        memset16(&main_bg_se_edit_row(y - 1)[8], 0x0401, 1); 
     }
 }
 
-static void game_round_end_panel_exit()
+static void game_round_end_rewards_move_row(int row)
 {
-    // TODO: make heads or tails of what's going on here and replace
-    // magic numbers.
-    if (timer < 8)
-    {
-        main_bg_se_copy_rect_1_tile_vert(TOP_LEFT_PANEL_ANIM_RECT, SE_UP);
-    
-        if (timer == 1) // Copied from shop. Feels slightly too niche of a function for me personally to make one.
-        {
-            reset_top_left_panel_bottom_row();
-        }
-        else if (timer == 2)
-        {
-            int y = 5;
-            memset16(&se_mem[MAIN_BG_SBB][32 * (y - 1)], 0x0001, 1);
-            memset16(&se_mem[MAIN_BG_SBB][1 + 32 * (y - 1)], 0x0002, 7);
-            memset16(&se_mem[MAIN_BG_SBB][8 + 32 * (y - 1)], 0x0401, 1); 
-        }
-    }   
-    else if (timer > FRAMES(20))
+    if (row == 1)
     {
-        memset16(&pal_bg_mem[REWARD_PANEL_BORDER_PID], 0x1483, 1);
-        state_info[game_state].substate = DISPLAY_REWARDS;
-        timer = TM_ZERO;
+        round_end_menu_expand_line(12);
+        return;
     }
+
+    int hand_y = hands > 0 ? 1 : 0;
+    round_end_menu_expand_line(12 + hand_y);
+
+    tte_printf("#{P:%d,%d; cx:0x%X000}%d #{cx:0x%X000}Hands", ROUND_END_NUM_HANDS_RECT.left, ROUND_END_NUM_HANDS_RECT.top, TTE_BLUE_PB,  hand_reward, TTE_WHITE_PB); // Print the hand reward
 }
 
-static void game_round_end_display_rewards()
+// Put the "cash out" button onto the round end panel
+static void game_round_end_cashout_move_row(int row)
 {
-    int hand_y = 0;
-    
-    // TODO: Implement interest
-    //int interest_y = 0;
-    
-    if (hands > 0)
-    {
-        hand_y = 1;
-    }
-    
-    // TODO: implement interest
-    // if (interest > 0)
-    // {
-    //     interest_y = 1 + hand_y;
-    // }
-    
-    if (hand_reward <= 0 && interest_reward <= 0) // Once all rewards are accounted for go to the next state
-    {
-        timer = TM_ZERO; // Reset the timer
-        state_info[game_state].substate = DISPLAY_CASHOUT; // Go to the next state
-    }
-    else if (timer == TM_START_ROUND_END_MENU_AMIN) // Expand the black part of the panel down by one tile
-    {
-        Rect single_line_rect = ROUND_END_MENU_RECT;
-        single_line_rect.top = 12;
-        single_line_rect.bottom = single_line_rect.top + 1;
-        main_bg_se_copy_rect_1_tile_vert(single_line_rect, SE_DOWN);
-    }
-    else if (timer < TM_ELLIPSIS_PRINT_MAX_TM) // Use TTE to print '.' until the end of the panel width
-    {
-        // Print the separator dots
-        int x = (8 + timer) * TILE_SIZE;
-        int y = (13) * TILE_SIZE;
-    
-        tte_printf("#{P:%d,%d; cx:0x%X000}.", x, y, TTE_WHITE_PB); 
-    }
-    else if (timer >= TM_DISPLAY_REWARDS_CONT_WAIT && hand_reward > 0) // Wait an additional 15 frames since the last sequenced action
-    {
-        if (timer == TM_DISPLAY_REWARDS_CONT_WAIT) // Expand the black part of the panel down by one tile again
-        {
-            Rect single_line_rect = ROUND_END_MENU_RECT;
-            single_line_rect.top = 12 + hand_y;
-            single_line_rect.bottom = single_line_rect.top + 1;
-            main_bg_se_copy_rect_1_tile_vert(single_line_rect, SE_DOWN);
-    
-            tte_printf("#{P:%d,%d; cx:0x%X000}%d #{cx:0x%X000}Hands", ROUND_END_NUM_HANDS_RECT.left, ROUND_END_NUM_HANDS_RECT.top, TTE_BLUE_PB,  hand_reward, TTE_WHITE_PB); // Print the hand reward
-        }
-        else if (timer > TM_HAND_REWARD_INCR_WAIT && timer % FRAMES(20) == 0) // After 15 frames, every 20 frames, increment the hand reward text until the hand reward variable is depleted
-        {
-            int y = (13 + hand_y) * TILE_SIZE;
-            hand_reward--;
-            tte_printf("#{P:%d, %d; cx:0x%X000}$%d", HAND_REWARD_RECT.left, y, TTE_YELLOW_PB, hands - hand_reward); // Print the hand reward
-        }
-    }
+    Rect left_rect = {4, 29, 4, 31};
+    BG_POINT left_point = {10, 8};
+    main_bg_se_copy_rect(left_rect, left_point);
+
+    Rect right_rect = {7, 29, 7, 31};
+    BG_POINT right_point = {23, 8};
+    main_bg_se_copy_rect(right_rect, right_point);
+
+    Rect top_rect = {11, 8, 22, 8};
+    BG_POINT top_point = {6, 29};
+    main_bg_se_fill_rect_with_se(main_bg_se_get_se(top_point), top_rect);
+
+    Rect middle_rect = {11, 9, 22, 9};
+    BG_POINT middle_point = {6, 30};
+    main_bg_se_fill_rect_with_se(main_bg_se_get_se(middle_point), middle_rect);
+
+    Rect bottom_rect = {11, 10, 22, 10};
+    BG_POINT bottom_point = {6, 31};
+    main_bg_se_fill_rect_with_se(main_bg_se_get_se(bottom_point), bottom_rect);
+
+    tte_printf("#{P:%d, %d; cx:0x%X000}Cash Out: $%d", CASHOUT_RECT.left, CASHOUT_RECT.top, TTE_WHITE_PB, hands + blind_get_reward(current_blind)); // Print the cash out amount
 }
 
-static void game_round_end_display_cashout()
+static void game_round_end_dismiss_move_row(int row)
 {
-    if (timer == FRAMES(40)) // Put the "cash out" button onto the round end panel
-    {
-        Rect left_rect = {4, 29, 4, 31};
-        BG_POINT left_point = {10, 8};
-        main_bg_se_copy_rect(left_rect, left_point);
-    
-        Rect right_rect = {7, 29, 7, 31};
-        BG_POINT right_point = {23, 8};
-        main_bg_se_copy_rect(right_rect, right_point);
-    
-        Rect top_rect = {11, 8, 22, 8};
-        BG_POINT top_point = {6, 29};
-        main_bg_se_fill_rect_with_se(main_bg_se_get_se(top_point), top_rect);
-    
-        Rect middle_rect = {11, 9, 22, 9};
-        BG_POINT middle_point = {6, 30};
-        main_bg_se_fill_rect_with_se(main_bg_se_get_se(middle_point), middle_rect);
-    
-        Rect bottom_rect = {11, 10, 22, 10};
-        BG_POINT bottom_point = {6, 31};
-        main_bg_se_fill_rect_with_se(main_bg_se_get_se(bottom_point), bottom_rect);
-    
-        tte_printf("#{P:%d, %d; cx:0x%X000}Cash Out: $%d", CASHOUT_RECT.left, CASHOUT_RECT.top, TTE_WHITE_PB, hands + blind_get_reward(current_blind)); // Print the cash out amount
-    }
-    else if (timer > FRAMES(40) && key_hit(SELECT_CARD)) // Wait until the player presses A to cash out
-    {
+    Rect round_end_down = ROUND_END_MENU_RECT;
+    round_end_down.top--;
+    main_bg_se_copy_rect_1_tile_vert(round_end_down, SE_DOWN);
+}
+
+static void game_round_end_dismiss_on_complete(void *data)
+{
+    panel_slide_update(&menu_slide);
+    state_info[GAME_STATE_ROUND_END].substate = ROUND_END_EXIT;
+    timer = TM_ZERO;
+}
+
+static void game_round_end_start_cashout()
+{
+    state_info[GAME_STATE_ROUND_END].substate = DISPLAY_CASHOUT;
+    timer = TM_ZERO;
+
+    round_end_cashout_keys[0] = (TweenKey)PANEL_SLIDE_KEY(0, max(FRAMES(ROUND_END_CASHOUT_WAIT_FRAMES) - 1, 1));
+    round_end_cashout_keys[1] = (TweenKey)PANEL_SLIDE_KEY(1, 1);
+    panel_slide_start(&menu_slide, round_end_cashout_keys, NUM_ELEM_IN_ARR(round_end_cashout_keys), game_round_end_cashout_move_row, panel_slide_on_complete);
+}
+
+static void game_round_end_panel_exit_on_complete(void *data)
+{
+    panel_slide_update(&menu_slide);
+    memset16(&pal_bg_shadow[REWARD_PANEL_BORDER_PID], 0x1483, 1);
+
+    // TODO: Implement interest
+    if (hand_reward <= 0 && interest_reward <= 0)
+    {
+        game_round_end_start_cashout();
+        return;
+    }
+
+    state_info[GAME_STATE_ROUND_END].substate = DISPLAY_REWARDS;
+    timer = TM_ZERO;
+    panel_slide_start(&menu_slide, round_end_rewards_keys, NUM_ELEM_IN_ARR(round_end_rewards_keys), game_round_end_rewards_move_row, panel_slide_on_complete);
+}
+
+static void game_round_end_score_min_on_complete(void *data)
+{
+    panel_slide_update(&menu_slide);
+    state_info[GAME_STATE_ROUND_END].substate = UPDATE_BLIND_REWARD;
+    timer = TM_ZERO;
+}
+
+static void game_round_end_blind_on_complete(void *data)
+{
+    panel_slide_update(&menu_slide);
+    state_info[GAME_STATE_ROUND_END].substate = DISPLAY_SCORE_MIN;
+    timer = TM_ZERO;
+    panel_slide_start(&menu_slide, round_end_score_min_keys, NUM_ELEM_IN_ARR(round_end_score_min_keys), game_round_end_score_min_move_row, game_round_end_score_min_on_complete);
+}
+
+static void game_round_end_pop_in_on_complete(void *data)
+{
+    panel_slide_update(&menu_slide);
+    state_info[GAME_STATE_ROUND_END].substate = DISPLAY_FINISHED_BLIND;
+    timer = TM_ZERO;
+    panel_slide_start(&menu_slide, round_end_blind_keys, NUM_ELEM_IN_ARR(round_end_blind_keys), game_round_end_blind_move_row, game_round_end_blind_on_complete);
+}
+
+static void game_round_end_start_on_complete(void *data)
+{
+    change_background(BG_ID_ROUND_END); // Change the background to the round end background
+    blind_reward = blind_get_reward(current_blind);
+    hand_reward = hands;
+
+    state_info[GAME_STATE_ROUND_END].substate = START_EXPAND_POPUP;
+    timer = TM_ZERO;
+    panel_slide_start(&menu_slide, round_end_pop_in_keys, NUM_ELEM_IN_ARR(round_end_pop_in_keys), game_round_end_pop_in_move_row, game_round_end_pop_in_on_complete);
+}
+
+static void game_round_end_on_init()
+{
+    panel_slide_start(&menu_slide, round_end_start_keys, NUM_ELEM_IN_ARR(round_end_start_keys), NULL, game_round_end_start_on_complete);
+}
+
+static void game_round_end_start()
+{
+    // Waiting for the start track
+}
+
+static void game_round_end_start_expand_popup()
+{
+    panel_slide_update(&menu_slide);
+}
+
+static void game_round_end_display_finished_blind()
+{
+    sprite_unhide(round_end_blind_token, 0);
+    
+    int current_ante = ante;
+    if (current_blind == BLIND_TYPE_BOSS) current_ante--; // Beating the boss blind increases the ante, so we need to display the previous ante value
+    
+    Rect blind_req_rect = ROUND_END_BLIND_REQ_RECT;
+    int blind_req = blind_get_requirement(current_blind, current_ante);
+    update_text_rect_to_right_align_num(&blind_req_rect, blind_req, OVERFLOW_RIGHT);
+    
+    tte_printf("#{P:%d,%d; cx:0x%X000}%d", blind_req_rect.left, blind_req_rect.top, TTE_RED_PB, blind_req);
+
+    panel_slide_update(&menu_slide);
+}
+
+static void game_round_end_display_score_min()
+{
+    panel_slide_update(&menu_slide);
+}
+
+static void game_round_end_update_blind_reward()
+{
+    if (timer % FRAMES(20) != 0) return;
+    
+    // TODO: Add sound effect here
+    
+    if (blind_reward > 0)
+    {
+        blind_reward--;
+        tte_printf("#{P:%d,%d; cx:0x%X000}$%d", BLIND_REWARD_RECT.left , BLIND_REWARD_RECT.top, TTE_YELLOW_PB, blind_reward);
+        tte_printf("#{P:%d,%d; cx:0x%X000}$%d", ROUND_END_BLIND_REWARD_RECT.left, ROUND_END_BLIND_REWARD_RECT.top, TTE_YELLOW_PB, blind_get_reward(current_blind) - blind_reward);
+    }
+    else if (timer > FRAMES(20))
+    {
+        tte_erase_rect_wrapper(BLIND_REWARD_RECT);
+        tte_erase_rect_wrapper(BLIND_REQ_TEXT_RECT);
+        sprite_hide(playing_blind_token);
+        affine_background_load_palette(affine_background_gfxPal);
+        state_info[game_state].substate = BLIND_PANEL_EXIT;
+        timer = TM_ZERO;
+
+        // The top left panel slides away, then there's a pause until the rewards
+        round_end_panel_exit_keys[0] = (TweenKey)PANEL_SLIDE_KEY(ROUND_END_PANEL_EXIT_ROWS, ROUND_END_PANEL_EXIT_ROWS);
+        round_end_panel_exit_keys[1] = (TweenKey)PANEL_SLIDE_KEY(ROUND_END_PANEL_EXIT_ROWS, max(FRAMES(20) + 1 - ROUND_END_PANEL_EXIT_ROWS, 1));
+        panel_slide_start(&menu_slide, round_end_panel_exit_keys, NUM_ELEM_IN_ARR(round_end_panel_exit_keys), game_round_end_panel_exit_move_row, game_round_end_panel_exit_on_complete);
+    }
+}
+
+static void game_round_end_panel_exit()
+{
+    panel_slide_update(&menu_slide);
+}
+
+static void game_round_end_display_rewards()
+{
+    if (hand_reward <= 0 && interest_reward <= 0) // Once all rewards are accounted for go to the next state
+    {
+        game_round_end_start_cashout();
+        return;
+    }
+
+    panel_slide_update(&menu_slide);
+
+    if (menu_slide.rows_moved == 1 && timer < TM_ELLIPSIS_PRINT_MAX_TM) // Use TTE to print '.' until the end of the panel width
+    {
+        // Print the separator dots
+        int x = (8 + timer) * TILE_SIZE;
+        int y = (13) * TILE_SIZE;
+    
+        tte_printf("#{P:%d,%d; cx:0x%X000}.", x, y, TTE_WHITE_PB); 
+    }
+    else if (menu_slide.rows_moved == 2 && timer > TM_HAND_REWARD_INCR_WAIT && timer % FRAMES(20) == 0) // After 15 frames, every 20 frames, increment the hand reward text until the hand reward variable is depleted
+    {
+        int hand_y = hands > 0 ? 1 : 0;
+        int y = (13 + hand_y) * TILE_SIZE;
+        hand_reward--;
+        tte_printf("#{P:%d, %d; cx:0x%X000}$%d", HAND_REWARD_RECT.left, y, TTE_YELLOW_PB, hands - hand_reward); // Print the hand reward
+    }
+}
+
+static void game_round_end_display_cashout()
+{
+    panel_slide_update(&menu_slide);
+
+    if (menu_slide.rows_moved == 1 && key_hit(SELECT_CARD)) // Wait until the player presses A to cash out
+    {
         game_round_end_cashout();
     
         state_info[game_state].substate = DISMISS_ROUND_END_PANEL; // Go to the next state
         timer = TM_ZERO; // Reset the timer
     
-        obj_hide(round_end_blind_token->obj); // Hide the blind token object
+        sprite_hide(round_end_blind_token); // Hide the blind token object
         tte_erase_rect_wrapper(BLIND_TOKEN_TEXT_RECT); // Erase the blind token text
+
+        panel_slide_start(&menu_slide, round_end_dismiss_keys, NUM_ELEM_IN_ARR(round_end_dismiss_keys), game_round_end_dismiss_move_row, game_round_end_dismiss_on_complete);
     }
 }
 
 static void game_round_end_dismiss_round_end_panel()
 {
-    Rect round_end_down = ROUND_END_MENU_RECT;
-    round_end_down.top--;
-    main_bg_se_copy_rect_1_tile_vert(round_end_down, SE_DOWN);
-    
-    if (timer >= TM_DISMISS_ROUND_END_TM)
-    {
-        timer = TM_ZERO; 
-        state_info[game_state].substate = ROUND_END_EXIT;
-    }
+    panel_slide_update(&menu_slide);
 }
 
 // Shop
@@ -2515,52 +2872,67 @@ static void game_shop_create_items()
         }
         
         
-        JokerObject *joker_object = joker_object_new(joker_new(joker_id));
+        JokerObject *joker_object = joker_object_new(joker_new(joker_id, joker_roll_edition()));
 
-        joker_object->sprite_object->x = int2fx(120 + i * CARD_SPRITE_SIZE);
-        joker_object->sprite_object->y = int2fx(160);
-        joker_object->sprite_object->tx = joker_object->sprite_object->x;
-        joker_object->sprite_object->ty = int2fx(ITEM_SHOP_Y);
+        joker_object->sprite_object.x = int2fx(120 + i * CARD_SPRITE_SIZE);
+        joker_object->sprite_object.y = int2fx(160);
+        joker_object->sprite_object.tx = joker_object->sprite_object.x;
+        joker_object->sprite_object.ty = int2fx(ITEM_SHOP_Y);
 
-        print_price_under_sprite_object(joker_object->sprite_object, joker_object->joker->value);
+        print_price_under_sprite_object(&joker_object->sprite_object, joker_object->joker->value);
 
-        sprite_position(joker_object_get_sprite(joker_object), fx2int(joker_object->sprite_object->x), fx2int(joker_object->sprite_object->y));
+        sprite_position(joker_object_get_sprite(joker_object), fx2int(joker_object->sprite_object.x), fx2int(joker_object->sprite_object.y));
         list_append(shop_jokers, joker_object);
     }
 }
 
-// Intro sequence (menu and shop icon coming into frame)
-static void game_shop_intro()
+static const TweenKey shop_intro_keys[] = { PANEL_SLIDE_KEY(MENU_POP_IN_ANIM_FRAMES, MENU_POP_IN_ANIM_FRAMES) };
+// The shop icon waits so it ends with the menu
+static const TweenKey shop_icon_intro_keys[] =
 {
-    main_bg_se_copy_rect_1_tile_vert(POP_MENU_ANIM_RECT, SE_UP);
+    PANEL_SLIDE_KEY(0, MENU_POP_IN_ANIM_FRAMES - TOP_LEFT_ITEM_ROWS),
+    PANEL_SLIDE_KEY(TOP_LEFT_ITEM_ROWS, TOP_LEFT_ITEM_ROWS)
+};
 
-    if (timer == TM_CREATE_SHOP_ITEMS_WAIT)
+static void game_shop_intro_move_row(int row)
+{
+    main_bg_se_slide_up_step(POP_MENU_ANIM_RECT, row, false);
+
+    if (row == MENU_POP_IN_ANIM_FRAMES)
     {
-        game_shop_create_items();
+        main_bg_se_slide_up_finish(POP_MENU_ANIM_RECT, row, false);
     }
+}
 
-    if (timer >= TM_SHIFT_SHOP_ICON_WAIT) // Shift the shop icon
-    {
-        int timer_offset = timer - 6;
+static void game_shop_icon_intro_move_row(int row)
+{
+    main_bg_se_slide_down_step(TOP_LEFT_ITEM_SRC_RECT, row);
+}
 
-        // TODO: Extract to generic function?
-        for (int y = 0; y < timer_offset; y++)
-        {
-            int y_from = 26 + y - timer_offset;
-            int y_to = 0 + y;
+static void game_shop_intro_on_complete(void *data)
+{
+    // Both tracks end on the same frame
+    panel_slide_update(&menu_slide);
+    panel_slide_update(&shop_icon_slide);
 
-            Rect from = { 0, y_from, 8, y_from };
-            BG_POINT to = { 0, y_to };
+    state_info[GAME_STATE_SHOP].substate = GAME_SHOP_ACTIVE;
+    timer = TM_ZERO; // Reset the timer
+}
 
-            main_bg_se_copy_rect(from, to);
-        }
-    }
+static void game_shop_on_init()
+{
+    change_background(BG_ID_SHOP);
+    game_shop_create_items();
 
-    if (timer == TM_END_GAME_SHOP_INTRO)
-    {
-        state_info[game_state].substate = GAME_SHOP_ACTIVE;
-        timer = TM_ZERO; // Reset the timer
-    }
+    // Intro sequence (menu and shop icon coming into frame)
+    panel_slide_start(&shop_icon_slide, shop_icon_intro_keys, NUM_ELEM_IN_ARR(shop_icon_intro_keys), game_shop_icon_intro_move_row, NULL);
+    panel_slide_start(&menu_slide, shop_intro_keys, NUM_ELEM_IN_ARR(shop_intro_keys), game_shop_intro_move_row, game_shop_intro_on_complete);
+}
+
+static void game_shop_intro()
+{
+    panel_slide_update(&menu_slide);
+    panel_slide_update(&shop_icon_slide);
 }
 
 static void game_shop_reroll(int *reroll_cost)
@@ -2586,7 +2958,7 @@ static void game_shop_reroll(int *reroll_cost)
         JokerObject *joker_object = list_get(shop_jokers, i);
         if (joker_object != NULL)
         {
-            joker_object->sprite_object->y = joker_object->sprite_object->ty; // Set the y position to the target position
+            joker_object->sprite_object.y = joker_object->sprite_object.ty; // Set the y position to the target position
             joker_object_shake(joker_object, UNDEFINED); // Give the joker a little wiggle animation
         }
     }
@@ -2608,23 +2980,35 @@ static void jokers_sel_row_on_selection_changed(SelectionGrid *selection_grid,
     if (prev_selection->y == row_idx)
     {
         JokerObject* joker_object = list_get(jokers, prev_selection->x);
-        erase_price_under_sprite_object(joker_object->sprite_object);
-        sprite_object_set_focus(joker_object->sprite_object, false);
+        erase_price_under_sprite_object(&joker_object->sprite_object);
+        sprite_object_set_focus(&joker_object->sprite_object, false);
     }
 
     if (new_selection->y == row_idx)
     {
         JokerObject* joker_object = list_get(jokers, new_selection->x);
-        sprite_object_set_focus(joker_object->sprite_object, true);
-        print_price_under_sprite_object(joker_object->sprite_object, joker_get_sell_value(joker_object->joker));
+        sprite_object_set_focus(&joker_object->sprite_object, true);
+        print_price_under_sprite_object(&joker_object->sprite_object, joker_get_sell_value(joker_object->joker));
     }
 }
 
+static void joker_on_discard_animation_done(void *data)
+{
+    JokerObject *joker_object = data;
+    list_remove_by_value(discarded_jokers, joker_object);
+    joker_object_destroy(&joker_object);
+}
+
 void joker_start_discard_animation(JokerObject *joker_object)
 {
-    joker_object->sprite_object->tx = int2fx(JOKER_DISCARD_TARGET.x);
-    joker_object->sprite_object->ty = int2fx(JOKER_DISCARD_TARGET.y);
     list_append(discarded_jokers, joker_object);
+
+    bool started = sprite_object_tween_to(&joker_object->sprite_object, int2fx(JOKER_DISCARD_TARGET.x), int2fx(JOKER_DISCARD_TARGET.y),
+                                          JOKER_DISCARD_ANIM_FRAMES, EASE_IN_QUAD, joker_on_discard_animation_done, joker_object);
+    if (!started)
+    {
+        joker_on_discard_animation_done(joker_object); // No tweens left, skip the animation
+    }
 }
 
 void game_sell_joker(int joker_idx)
@@ -2635,7 +3019,7 @@ void game_sell_joker(int joker_idx)
     JokerObject *joker_object = list_get(jokers, joker_idx);
     money += joker_get_sell_value(joker_object->joker);
     display_money(money);
-    erase_price_under_sprite_object(joker_object->sprite_object);
+    erase_price_under_sprite_object(&joker_object->sprite_object);
 
     remove_held_joker(joker_idx);
     int_list_append(jokers_available_to_shop, (intptr_t)joker_object->joker->id);
@@ -2653,6 +3037,55 @@ static void jokers_sel_row_on_key_hit(SelectionGrid* selection_grid, Selection*
     selection_grid_move_selection_vert(selection_grid, SCREEN_DOWN);
 }
 
+static const TweenKey shop_outro_keys[] = { PANEL_SLIDE_KEY(MENU_POP_OUT_ANIM_FRAMES, MENU_POP_OUT_ANIM_FRAMES) };
+
+static void game_shop_outro_move_row(int row)
+{
+    // Shift the shop panel
+    main_bg_se_move_rect_1_tile_vert(POP_MENU_ANIM_RECT, SE_DOWN);
+
+    main_bg_se_copy_rect_1_tile_vert(TOP_LEFT_PANEL_ANIM_RECT, SE_UP);
+
+    // TODO: make heads or tails of what's going on here and replace
+    // magic numbers.
+    if (row == 1)
+    {
+        reset_top_left_panel_bottom_row();
+    }
+    else if (row == 2)
+    {
+        int y = 5;
+        memset16(&main_bg_se_edit_row(y - 1)[0], 0x0001, 1);
+        memset16(&main_bg_se_edit_row(y - 1)[1], 0x0002, 7);
+        memset16(&main_bg_se_edit_row(y - 1)[8], SE_HFLIP | 0x0001, 1);
+    }
+}
+
+static void game_shop_outro_on_complete(void *data)
+{
+    panel_slide_update(&menu_slide);
+    state_info[GAME_STATE_SHOP].substate = GAME_SHOP_MAX; // Go to the next state
+}
+
+// Outro sequence (menu and shop icon going out of frame)
+static void game_shop_start_outro()
+{
+    state_info[game_state].substate = GAME_SHOP_EXIT; // Go to the outro sequence state
+
+    tte_erase_rect_wrapper(SHOP_PRICES_TEXT_RECT); // Erase the shop prices text
+
+    for (int i = 0; i < list_get_size(shop_jokers); i++)
+    {
+        JokerObject *joker_object = list_get(shop_jokers, i);
+        if (joker_object != NULL)
+        {
+            joker_object->sprite_object.ty = int2fx(160);
+        }
+    }
+
+    panel_slide_start(&menu_slide, shop_outro_keys, NUM_ELEM_IN_ARR(shop_outro_keys), game_shop_outro_move_row, game_shop_outro_on_complete);
+}
+
 // Shop input
 static int shop_top_row_get_size()
 {
@@ -2661,7 +3094,7 @@ static int shop_top_row_get_size()
 
 static void add_to_held_jokers(JokerObject *joker_object)
 {
-    joker_object->sprite_object->ty = int2fx(HELD_JOKERS_POS.y);
+    joker_object->sprite_object.ty = int2fx(HELD_JOKERS_POS.y);
     add_joker(joker_object);
 }
 
@@ -2671,8 +3104,8 @@ static void game_shop_buy_joker(int shop_joker_idx)
 
     money -= joker_object->joker->value; // Deduct the money spent on the joker
     display_money(money);                // Update the money display
-    erase_price_under_sprite_object(joker_object->sprite_object);
-    sprite_object_set_focus(joker_object->sprite_object, false);
+    erase_price_under_sprite_object(&joker_object->sprite_object);
+    sprite_object_set_focus(&joker_object->sprite_object, false);
     add_to_held_jokers(joker_object);
     list_remove_by_idx(shop_jokers, shop_joker_idx); // Remove the joker from the shop
 }
@@ -2685,13 +3118,12 @@ static void shop_top_row_on_key_hit(SelectionGrid* selection_grid, Selection* se
     if (selection->x == NEXT_ROUND_BTN_SEL_X)
     {
         // Go to next blind selection game state
-        state_info[game_state].substate = GAME_SHOP_EXIT; // Go to the outro sequence state
-        timer = TM_ZERO; // Reset the timer
+        game_shop_start_outro();
         reroll_cost = REROLL_BASE_COST;
 
-        memcpy16(&pal_bg_mem[NEXT_ROUND_BTN_SELECTED_BORDER_PID], &pal_bg_mem[SHOP_PANEL_SHADOW_PID], 1);
+        memcpy16(&pal_bg_shadow[NEXT_ROUND_BTN_SELECTED_BORDER_PID], &pal_bg_shadow[SHOP_PANEL_SHADOW_PID], 1);
 
-        // memcpy16(&pal_bg_mem[16], &pal_bg_mem[6], 1); 
+        // memcpy16(&pal_bg_shadow[16], &pal_bg_shadow[6], 1); 
         // This changes the color of the button to a dark red.
         // However, it shares a palette with the shop icon, so it will change the color of the shop icon as well.
         // And I don't care enough to fix it right now.
@@ -2701,7 +3133,7 @@ static void shop_top_row_on_key_hit(SelectionGrid* selection_grid, Selection* se
         int shop_joker_idx = selection->x - 1; // - 1 to account for next round button
         JokerObject *joker_object = list_get(shop_jokers, shop_joker_idx);
         if (joker_object == NULL 
-            || list_get_size(jokers) >= MAX_JOKERS_HELD_SIZE
+            || !can_hold_joker(joker_object->joker)
             || money < joker_object->joker->value)
         {
             return;
@@ -2724,12 +3156,12 @@ static void shop_top_row_on_selection_changed(SelectionGrid* selection_grid, int
         if (prev_selection->x == NEXT_ROUND_BTN_SEL_X)
         {
             // Remove next round button highlight
-            memcpy16(&pal_bg_mem[NEXT_ROUND_BTN_SELECTED_BORDER_PID], &pal_bg_mem[NEXT_ROUND_BTN_PID], 1);
+            memcpy16(&pal_bg_shadow[NEXT_ROUND_BTN_SELECTED_BORDER_PID], &pal_bg_shadow[NEXT_ROUND_BTN_PID], 1);
         }
         else 
         {
             JokerObject *joker = list_get(shop_jokers, prev_selection->x - 1);
-            sprite_object_set_focus(joker->sprite_object, false); 
+            sprite_object_set_focus(&joker->sprite_object, false); 
             // -1 to account for next round button
         }
     }
@@ -2739,12 +3171,12 @@ static void shop_top_row_on_selection_changed(SelectionGrid* selection_grid, int
         if (new_selection->x == NEXT_ROUND_BTN_SEL_X)
         {
             // Highlight next round button
-            memset16(&pal_bg_mem[NEXT_ROUND_BTN_SELECTED_BORDER_PID], HIGHLIGHT_COLOR, 1);
+            memset16(&pal_bg_shadow[NEXT_ROUND_BTN_SELECTED_BORDER_PID], HIGHLIGHT_COLOR, 1);
         }
         else 
         {
             JokerObject *joker = list_get(shop_jokers, new_selection->x - 1);
-            sprite_object_set_focus(joker->sprite_object, true); 
+            sprite_object_set_focus(&joker->sprite_object, true); 
             // -1 to account for next round button
         }
     }
@@ -2760,11 +3192,11 @@ static void shop_reroll_row_on_selection_changed(SelectionGrid* selection_grid,
     if (row_idx == prev_selection->y)
     {
         // Remove highlight
-        memcpy16(&pal_bg_mem[REROLL_BTN_SELECTED_BORDER_PID], &pal_bg_mem[REROLL_BTN_PID], 1);
+        memcpy16(&pal_bg_shadow[REROLL_BTN_SELECTED_BORDER_PID], &pal_bg_shadow[REROLL_BTN_PID], 1);
     }
     else if (row_idx == new_selection->y)
     {
-        memset16(&pal_bg_mem[REROLL_BTN_SELECTED_BORDER_PID], HIGHLIGHT_COLOR, 1);
+        memset16(&pal_bg_shadow[REROLL_BTN_SELECTED_BORDER_PID], HIGHLIGHT_COLOR, 1);
     }
 }
 
@@ -2803,69 +3235,9 @@ static void game_shop_process_user_input()
     selection_grid_process_input(&shop_selection_grid);
 }
 
-static void game_shop_lights_anim_frame()
-{
-    // Shift palette around the border of the shop icon
-    COLOR shifted_palette[4];
-    memcpy16(&shifted_palette[0], &pal_bg_mem[SHOP_LIGHTS_2_PID], 1);
-    memcpy16(&shifted_palette[1], &pal_bg_mem[SHOP_LIGHTS_3_PID], 1);
-    memcpy16(&shifted_palette[2], &pal_bg_mem[SHOP_LIGHTS_4_PID], 1);
-    memcpy16(&shifted_palette[3], &pal_bg_mem[SHOP_LIGHTS_1_PID], 1);
-
-    // Circularly shift the palette
-    int last = shifted_palette[3];
-
-    for (int i = 3; i > 0; --i)
-    {
-        shifted_palette[i] = shifted_palette[i - 1];
-    }
-
-    shifted_palette[0] = last;
-
-    memcpy16(&pal_bg_mem[SHOP_LIGHTS_2_PID], &shifted_palette[0], 1); // Copy the shifted palette to the next 4 slots
-    memcpy16(&pal_bg_mem[SHOP_LIGHTS_3_PID], &shifted_palette[1], 1);
-    memcpy16(&pal_bg_mem[SHOP_LIGHTS_4_PID], &shifted_palette[2], 1);
-    memcpy16(&pal_bg_mem[SHOP_LIGHTS_1_PID], &shifted_palette[3], 1);
-}
-
-// Outro sequence (menu and shop icon going out of frame)
 static void game_shop_outro()
 {
-    // Shift the shop panel
-    main_bg_se_move_rect_1_tile_vert(POP_MENU_ANIM_RECT, SE_DOWN);
-
-    main_bg_se_copy_rect_1_tile_vert(TOP_LEFT_PANEL_ANIM_RECT, SE_UP);
-
-    // TODO: make heads or tails of what's going on here and replace
-    // magic numbers.
-    if (timer == 1)
-    {
-        tte_erase_rect_wrapper(SHOP_PRICES_TEXT_RECT); // Erase the shop prices text
-
-        for (int i = 0; i < list_get_size(shop_jokers); i++)
-        {
-            JokerObject *joker_object = list_get(shop_jokers, i);
-            if (joker_object != NULL)
-            {
-                joker_object->sprite_object->ty = int2fx(160);
-            }
-        }
-
-        reset_top_left_panel_bottom_row();
-    }
-    else if (timer == 2)
-    {
-        int y = 5;
-        memset16(&se_mat[MAIN_BG_SBB][y - 1][0], 0x0001, 1);
-        memset16(&se_mat[MAIN_BG_SBB][y - 1][1], 0x0002, 7);
-        memset16(&se_mat[MAIN_BG_SBB][y - 1][8], SE_HFLIP | 0x0001, 1);
-    }
-
-    if (timer >= MENU_POP_OUT_ANIM_FRAMES)
-    {
-        state_info[game_state].substate = GAME_SHOP_MAX; // Go to the next state
-        timer = TM_ZERO; // Reset the timer
-    }
+    panel_slide_update(&menu_slide);
 }
 
 static void game_shop_on_update()
@@ -2879,14 +3251,11 @@ static void game_shop_on_update()
             JokerObject *joker_object = list_get(shop_jokers, i);
             if (joker_object != NULL)
             {
-                joker_object_update(joker_object);
+                sprite_object_batch_add(&joker_object->sprite_object);
             }
         }
-    }
 
-    if (timer % 20 == 0)
-    {
-        game_shop_lights_anim_frame();
+        sprite_object_batch_flush();
     }
 
     if (state_info[game_state].substate == GAME_SHOP_MAX)
@@ -2914,6 +3283,9 @@ static void game_shop_on_exit()
     }
     
     list_destroy(&shop_jokers);
+
+    pal_fx_cycle_stop(shop_lights_cycle);
+    shop_lights_cycle = UNDEFINED;
     
     increment_blind(BLIND_STATE_DEFEATED); // TODO: Move to game_round_end()?
 }
@@ -2930,23 +3302,107 @@ static void game_blind_select_on_update()
     blind_select_state_actions[substate]();
 }
 
-static void game_blind_select_start_anim_seq()
+static const TweenKey blind_select_intro_keys[] = { PANEL_SLIDE_KEY(MENU_POP_IN_ANIM_FRAMES, MENU_POP_IN_ANIM_FRAMES) };
+static const TweenKey blind_selected_keys[] =
 {
-    change_background(BG_ID_BLIND_SELECT);
-    main_bg_se_copy_rect_1_tile_vert(POP_MENU_ANIM_RECT, SE_UP);
-    
+    PANEL_SLIDE_KEY(BLIND_SELECTED_ANIM_ROWS, BLIND_SELECTED_ANIM_ROWS),
+    PANEL_SLIDE_KEY(BLIND_SELECTED_ANIM_ROWS, MENU_POP_OUT_ANIM_FRAMES - BLIND_SELECTED_ANIM_ROWS)
+};
+static const TweenKey blind_panel_keys[] = { PANEL_SLIDE_KEY(TOP_LEFT_ITEM_ROWS, TOP_LEFT_ITEM_ROWS) };
+
+static void game_blind_select_intro_move_row(int row)
+{
+    main_bg_se_slide_up_step(POP_MENU_ANIM_RECT, row, false);
+
+    if (row == MENU_POP_IN_ANIM_FRAMES)
+    {
+        main_bg_se_slide_up_finish(POP_MENU_ANIM_RECT, row, false);
+    }
+
     for (int i = 0; i < BLIND_TYPE_MAX; i++)
     {
         sprite_position(blind_select_tokens[i], blind_select_tokens[i]->pos.x, blind_select_tokens[i]->pos.y - TILE_SIZE);
     }
-    
-    if (timer == TM_END_ANIM_SEQ)
+}
+
+static void game_blind_select_intro_on_complete(void *data)
+{
+    panel_slide_update(&menu_slide);
+    state_info[GAME_STATE_BLIND_SELECT].substate = BLIND_SELECT;
+    timer = TM_ZERO; // Reset the timer
+}
+
+static void game_blind_select_on_init()
+{
+    change_background(BG_ID_BLIND_SELECT);
+    panel_slide_start(&menu_slide, blind_select_intro_keys, NUM_ELEM_IN_ARR(blind_select_intro_keys), game_blind_select_intro_move_row, game_blind_select_intro_on_complete);
+}
+
+static void game_blind_select_start_anim_seq()
+{
+    panel_slide_update(&menu_slide);
+}
+
+static void game_blind_select_selected_move_row(int row)
+{
+    Rect blinds_rect = POP_MENU_ANIM_RECT;
+    blinds_rect.top -= 1; // Because of the raised blind
+    main_bg_se_move_rect_1_tile_vert(blinds_rect, SE_DOWN);
+
+    for (int i = 0; i < BLIND_TYPE_MAX; i++)
     {
-        state_info[game_state].substate = BLIND_SELECT;
-        timer = TM_ZERO; // Reset the timer
+        sprite_position(blind_select_tokens[i], blind_select_tokens[i]->pos.x, blind_select_tokens[i]->pos.y + TILE_SIZE);
     }
 }
 
+static void game_blind_panel_move_row(int row)
+{
+    main_bg_se_slide_down_step(TOP_LEFT_ITEM_SRC_RECT, row); // Shift the blind panel down onto screen
+}
+
+static void game_blind_panel_on_complete(void *data)
+{
+    panel_slide_update(&menu_slide);
+    state_info[GAME_STATE_BLIND_SELECT].substate = BLIND_SELECT_MAX;
+}
+
+// Switches to the selecting background and clears the blind panel area before it slides in
+static void game_blind_select_start_blind_panel()
+{
+    state_info[GAME_STATE_BLIND_SELECT].substate = DISPLAY_BLIND_PANEL;
+
+    change_background(BG_ID_CARD_SELECTING);
+
+    main_bg_se_clear_rect(ROUND_END_MENU_RECT);
+
+    for (int y = 0; y < 5; y++)
+    {
+        int y_from = 28;
+        int y_to = 0 + y;
+
+        Rect from = {0, y_from, 8, y_from + 1};
+        BG_POINT to = {0, y_to};
+
+        main_bg_se_copy_rect(from, to);
+    }
+
+    reset_top_left_panel_bottom_row();
+
+    panel_slide_start(&menu_slide, blind_panel_keys, NUM_ELEM_IN_ARR(blind_panel_keys), game_blind_panel_move_row, game_blind_panel_on_complete);
+}
+
+static void game_blind_select_selected_on_complete(void *data)
+{
+    panel_slide_update(&menu_slide);
+
+    for (int i = 0; i < BLIND_TYPE_MAX; i++)
+    {
+        sprite_hide(blind_select_tokens[i]);
+    }
+
+    game_blind_select_start_blind_panel();
+}
+
 static void game_blind_select_handle_input()
 {
     if (timer == TM_BLIND_SELECT_START && current_blind == BLIND_TYPE_BOSS)
@@ -2968,7 +3424,7 @@ static void game_blind_select_handle_input()
         if (selection_y == 0) // Blind selected
         {
             state_info[game_state].substate = BLIND_SELECTED_ANIM_SEQ;
-            timer = TM_ZERO;
+            panel_slide_start(&menu_slide, blind_selected_keys, NUM_ELEM_IN_ARR(blind_selected_keys), game_blind_select_selected_move_row, game_blind_select_selected_on_complete);
             display_round(++round);
         }
         else if (current_blind != BLIND_TYPE_BOSS)
@@ -2978,11 +3434,7 @@ static void game_blind_select_handle_input()
             background = UNDEFINED; // Force refresh of the background
             change_background(BG_ID_BLIND_SELECT);
     
-            // TODO: Create a generic vertical move by any number of tiles to avoid for loops?
-            for (int i = 0; i < 12; i++)
-            {
-                main_bg_se_copy_rect_1_tile_vert(POP_MENU_ANIM_RECT, SE_UP);
-            }
+            main_bg_se_copy_rect_n_tiles_vert(POP_MENU_ANIM_RECT, SE_UP, 12);
     
             for (int i = 0; i < BLIND_TYPE_MAX; i++)
             {
@@ -2996,80 +3448,25 @@ static void game_blind_select_handle_input()
     if (selection_y == 0)
     {
     	// 5 is the multiplier palette color and the skip button color
-        memset16(&pal_bg_mem[BLIND_SELECT_BTN_SELECTED_BORDER_PID], 0xFFFF, 1);
-        memcpy16(&pal_bg_mem[BLIND_SKIP_BTN_SELECTED_BORDER_PID], &pal_bg_mem[BLIND_SKIP_BTN_PID], 1);
+        memset16(&pal_bg_shadow[BLIND_SELECT_BTN_SELECTED_BORDER_PID], 0xFFFF, 1);
+        memcpy16(&pal_bg_shadow[BLIND_SKIP_BTN_SELECTED_BORDER_PID], &pal_bg_shadow[BLIND_SKIP_BTN_PID], 1);
     }
     else
     {
     	// 15 is the select button color
-        memcpy16(&pal_bg_mem[BLIND_SELECT_BTN_SELECTED_BORDER_PID], &pal_bg_mem[BLIND_SELECT_BTN_PID], 1);
-        memset16(&pal_bg_mem[BLIND_SKIP_BTN_SELECTED_BORDER_PID], 0xFFFF, 1);
+        memcpy16(&pal_bg_shadow[BLIND_SELECT_BTN_SELECTED_BORDER_PID], &pal_bg_shadow[BLIND_SELECT_BTN_PID], 1);
+        memset16(&pal_bg_shadow[BLIND_SKIP_BTN_SELECTED_BORDER_PID], 0xFFFF, 1);
     }
 }
 
 static void game_blind_select_selected_anim_seq()
 {
-    if (timer < 15)
-    {
-        Rect blinds_rect = POP_MENU_ANIM_RECT;
-        blinds_rect.top -= 1; // Because of the raised blind
-        main_bg_se_move_rect_1_tile_vert(blinds_rect, SE_DOWN);
-    
-        for (int i = 0; i < BLIND_TYPE_MAX; i++)
-        {
-            sprite_position(blind_select_tokens[i], blind_select_tokens[i]->pos.x, blind_select_tokens[i]->pos.y + TILE_SIZE);
-        }
-    }
-    else if (timer >= MENU_POP_OUT_ANIM_FRAMES)
-    {
-        for (int i = 0; i < BLIND_TYPE_MAX; i++)
-        {
-            obj_hide(blind_select_tokens[i]->obj);
-        }
-    
-        state_info[game_state].substate = DISPLAY_BLIND_PANEL; // Reset the state
-        timer = TM_ZERO; // Reset the timer
-    }
+    panel_slide_update(&menu_slide);
 }
 
 static void game_blind_select_display_blind_panel()
 {
-    if (timer >= TM_DISP_BLIND_PANEL_FINISH)
-    {
-    	state_info[game_state].substate = BLIND_SELECT_MAX;
-    	return;
-    }
-    
-    if (timer == TM_DISP_BLIND_PANEL_START) // Switches to the selecting background and clears the blind panel area
-    {
-        change_background(BG_ID_CARD_SELECTING);
-    
-        main_bg_se_clear_rect(ROUND_END_MENU_RECT);
-    
-        for (int y = 0; y < 5; y++)
-        {
-            int y_from = 28;
-            int y_to = 0 + y;
-    
-            Rect from = {0, y_from, 8, y_from + 1};
-            BG_POINT to = {0, y_to};
-    
-            main_bg_se_copy_rect(from, to);
-        }
-    
-        reset_top_left_panel_bottom_row();
-    }
-    
-    for (int y = 0; y < timer; y++) // Shift the blind panel down onto screen
-    {
-        int y_from = 26 + y - timer;
-        int y_to = 0 + y;
-    
-        Rect from = {0, y_from, 8, y_from};
-        BG_POINT to = {0, y_to};
-    
-        main_bg_se_copy_rect(from, to);
-    }
+    panel_slide_update(&menu_slide);
 }
 
 static void game_blind_select_on_exit()
@@ -3083,8 +3480,8 @@ static void game_main_menu_on_update()
     change_background(BG_ID_MAIN_MENU);
 
     card_object_update(main_menu_ace);
-    main_menu_ace->sprite_object->trotation = lu_sin((timer << 8) / 2) / 3;
-    main_menu_ace->sprite_object->rotation = main_menu_ace->sprite_object->trotation;
+    main_menu_ace->sprite_object.trotation = lu_sin((timer << 8) / 2) / 3;
+    main_menu_ace->sprite_object.rotation = main_menu_ace->sprite_object.trotation;
 
     // Seed randomization
     rng_seed++;
@@ -3111,7 +3508,7 @@ static void game_main_menu_on_update()
     if (selection_x == 0) // Play button
     {   
         // Select button PID is 5 and the outline is 3
-        memset16(&pal_bg_mem[MAIN_MENU_PLAY_BUTTON_OUTLINE_PID], HIGHLIGHT_COLOR, 1);
+        memset16(&pal_bg_shadow[MAIN_MENU_PLAY_BUTTON_OUTLINE_PID], HIGHLIGHT_COLOR, 1);
 
         if (key_hit(KEY_A))
         {
@@ -3122,7 +3519,7 @@ static void game_main_menu_on_update()
     else
     {
         // Select button PID is 5 and the outline is 3
-        memcpy16(&pal_bg_mem[MAIN_MENU_PLAY_BUTTON_OUTLINE_PID], &pal_bg_mem[MAIN_MENU_PLAY_BUTTON_MAIN_COLOR_PID], 1);
+        memcpy16(&pal_bg_shadow[MAIN_MENU_PLAY_BUTTON_OUTLINE_PID], &pal_bg_shadow[MAIN_MENU_PLAY_BUTTON_MAIN_COLOR_PID], 1);
     }
 }
 
@@ -3131,41 +3528,65 @@ static void discarded_jokers_update_loop()
     if (discarded_jokers == NULL)
         return;
     
+    // They're destroyed by joker_on_discard_animation_done() once their tween ends
+    // or as soon as they're out of sight, whichever comes first.
     // Iterating backwards because of removal within loop
     for (int i = list_get_size(discarded_jokers) - 1; i >= 0; i--)
     {
-        JokerObject* joker_object = list_get(discarded_jokers, i);
+        JokerObject *joker_object = list_get(discarded_jokers, i);
         joker_object_update(joker_object);
-        if (joker_object->sprite_object->x == joker_object->sprite_object->tx
-            && joker_object->sprite_object->y == joker_object->sprite_object->ty)
+
+        if (sprite_object_has_left_screen(&joker_object->sprite_object))
         {
-            list_remove_by_idx(discarded_jokers, i);
-            joker_object_destroy(&joker_object);        
+            joker_on_discard_animation_done(joker_object);
         }
     }
 }
 
 static void held_jokers_update_loop()
 {
-    const int spacing_lut[MAX_JOKERS_HELD_SIZE][MAX_JOKERS_HELD_SIZE] = 
-    {
-        {0, 0, 0, 0, 0},
-        {13, -13, 0, 0, 0},
-        {26, 0, -26, 0, 0},
-        {39, 13, -13, -39, 0},
-        {40, 20, 0, -20, -40}
-    };
-
     FIXED hand_x = int2fx(HELD_JOKERS_POS.x);
 
-    int jokers_top = list_get_size(jokers) - 1;
-    for (int i = jokers_top; i >= 0; i--)
+    int num_jokers = list_get_size(jokers);
+    int visible_top = min(num_jokers, MAX_VISIBLE_HELD_JOKERS) - 1;
+
+    // Jokers are spread evenly and squeezed together once they no longer fit in the strip
+    int spacing = HELD_JOKERS_MAX_SPACING;
+    if (visible_top > 0)
+    {
+        spacing = min(spacing, HELD_JOKERS_STRIP_WIDTH / visible_top);
+    }
+
+    for (int i = num_jokers - 1; i >= 0; i--)
     {
         JokerObject *joker = list_get(jokers, i);
-        joker->sprite_object->tx = hand_x - int2fx(spacing_lut[jokers_top][i]);
+        SpriteObject *sprite_object = &joker->sprite_object;
+        int y;
 
-        joker_object_update(joker);
+        if (i <= visible_top)
+        {
+            joker_object_set_compact(joker, false);
+            sprite_object->tx = hand_x - int2fx(spacing * (visible_top - 2 * i)) / 2;
+            y = HELD_JOKERS_POS.y;
+        }
+        else
+        {
+            int icon_idx = i - visible_top - 1;
+            joker_object_set_compact(joker, true);
+            sprite_object->tx = int2fx(HELD_JOKER_ICONS_POS.x + (icon_idx % HELD_JOKER_ICONS_PER_ROW) * HELD_JOKER_ICON_SPACING);
+            y = HELD_JOKER_ICONS_POS.y + (icon_idx / HELD_JOKER_ICONS_PER_ROW) * HELD_JOKER_ICON_SPACING;
+        }
+
+        // Focused jokers are raised so leave them be
+        if (!sprite_object_is_focused(sprite_object))
+        {
+            sprite_object->ty = int2fx(y);
+        }
+
+        sprite_object_batch_add(sprite_object);
     }
+
+    sprite_object_batch_flush();
 }
 
 static void jokers_update_loop()
@@ -3176,7 +3597,12 @@ static void jokers_update_loop()
 
 static void game_over_anim_frame()
 {
-    main_bg_se_move_rect_1_tile_vert(GAME_OVER_ANIM_RECT, SE_UP);
+    main_bg_se_slide_up_step(GAME_OVER_ANIM_RECT, timer, true);
+
+    if (timer == GAME_OVER_ANIM_FRAMES - 1)
+    {
+        main_bg_se_slide_up_finish(GAME_OVER_ANIM_RECT, timer, true);
+    }
 }
 
 static void game_lose_on_update()
@@ -3206,9 +3632,7 @@ static void game_over_on_exit()
 
     tte_erase_screen();
 
-    // For some reason that I haven't figured out yet,
-    // if I don't destroy the blind tokens they won't
-    // show up on the next run.
+    // The tokens are created again for the next run, destroy these so they don't pile up
     sprite_destroy(&playing_blind_token);
     sprite_destroy(&round_end_blind_token);
     sprite_destroy(&blind_select_tokens[BLIND_TYPE_SMALL]);
@@ -3236,6 +3660,7 @@ static void game_over_on_exit()
     ); // Ante
 
     affine_background_load_palette(affine_background_gfxPal);
+    pal_fx_fade(CLR_BLACK, PAL_FX_FADE_MAX, 0, GAME_RESTART_FADE_FRAMES);
 }
 
 static void game_win_on_update()
@@ -3259,4 +3684,7 @@ void game_update()
     jokers_update_loop();
 
     state_info[game_state].on_update();
+
+    // After the state update so a substate a callback switches to starts on the next frame, like with the timer
+    tween_update();
 }
@@ -7,6 +7,24 @@
 
 const Rect FULL_SCREENBLOCK_RECT = { 0, 0, SE_ROW_LEN - 1, SE_COL_LEN - 1};
 
+// The main background isn't scrolled so the rows below the screen are never shown,
+// they hold the panel parts that are copied onto the screen and only need to be in the shadow
+#define MAIN_BG_VISIBLE_ROWS (SCREEN_HEIGHT / TILE_SIZE)
+
+// The main background is edited here and the rows that changed are committed during VBlank
+static SE main_bg_se_shadow[SE_COL_LEN][SE_ROW_LEN] ALIGN4;
+static u32 main_bg_se_dirty_rows = 0; // One bit per row
+static uint main_bg_se_commit_bytes = 0;
+
+// Rows are inclusive and clamped to the visible rows
+static void main_bg_se_mark_rows_dirty(int top, int bottom)
+{
+    for (int y = max(top, 0); y <= min(bottom, MAIN_BG_VISIBLE_ROWS - 1); y++)
+    {
+        main_bg_se_dirty_rows |= 1u << y;
+    }
+}
+
 // Clips a rect of screenblock entries to a specified rect
 // The bounding rect is not required to be within screenblock boundaries
 static void clip_se_rect_to_bounding_rect(Rect* rect, const Rect* bounding_rect)
@@ -26,7 +44,67 @@ static void clip_se_rect_to_screenblock(Rect* rect)
 
 SE main_bg_se_get_se(BG_POINT pos)
 {
-    return se_mat[MAIN_BG_SBB][pos.y][pos.x];
+    return main_bg_se_shadow[pos.y][pos.x];
+}
+
+const SE *main_bg_se_get_row(int y)
+{
+    return main_bg_se_shadow[y];
+}
+
+SE *main_bg_se_edit_row(int y)
+{
+    main_bg_se_mark_rows_dirty(y, y);
+    return main_bg_se_shadow[y];
+}
+
+void main_bg_se_copy_rows(const SE *src, int top, int num_rows)
+{
+    memcpy16(main_bg_se_shadow[top], src, num_rows * SE_ROW_LEN);
+    main_bg_se_mark_rows_dirty(top, top + num_rows - 1);
+}
+
+void main_bg_se_load(const SE *map, int num_rows)
+{
+    memcpy16(main_bg_se_shadow, map, num_rows * SE_ROW_LEN);
+    memcpy16(se_mem[MAIN_BG_SBB], map, num_rows * SE_ROW_LEN);
+    for (int y = 0; y < num_rows; y++)
+    {
+        main_bg_se_dirty_rows &= ~(1u << y);
+    }
+}
+
+void main_bg_se_commit(void)
+{
+    main_bg_se_commit_bytes = 0;
+
+    // One DMA per run of consecutive dirty rows
+    for (int top = 0; top < MAIN_BG_VISIBLE_ROWS && main_bg_se_dirty_rows != 0; top++)
+    {
+        if ((main_bg_se_dirty_rows & (1u << top)) == 0)
+            continue;
+
+        int bottom = top;
+        while (bottom + 1 < MAIN_BG_VISIBLE_ROWS && (main_bg_se_dirty_rows & (1u << (bottom + 1))) != 0)
+        {
+            bottom++;
+        }
+
+        uint num_bytes = (bottom - top + 1) * SE_ROW_LEN * sizeof(SE);
+        dma3_cpy(se_mat[MAIN_BG_SBB][top], main_bg_se_shadow[top], num_bytes);
+        main_bg_se_commit_bytes += num_bytes;
+
+        for (int y = top; y <= bottom; y++)
+        {
+            main_bg_se_dirty_rows &= ~(1u << y);
+        }
+        top = bottom;
+    }
+}
+
+uint main_bg_se_get_commit_bytes(void)
+{
+    return main_bg_se_commit_bytes;
 }
 
 // Clips a rect of screenblock entries to be within one step of 
@@ -55,12 +133,13 @@ void main_bg_se_clear_rect(Rect se_rect)
 
     for (int y = se_rect.top; y < se_rect.bottom; y++)
     {
-        memset16(&(se_mat[MAIN_BG_SBB][y][se_rect.left]), 0x0000, rect_width(&se_rect));
+        memset16(&main_bg_se_shadow[y][se_rect.left], 0x0000, rect_width(&se_rect));
     }
+    main_bg_se_mark_rows_dirty(se_rect.top, se_rect.bottom - 1);
 }
 
 // Internal static function to merge implementation of move/copy functions.
-static void bg_se_copy_or_move_rect_1_tile_vert(u16 bg_sbb, Rect se_rect, int direction, bool move)
+static void bg_se_copy_or_move_rect_1_tile_vert(SE (*rows)[SE_ROW_LEN], Rect se_rect, int direction, bool move)
 {
      if (se_rect.left > se_rect.right
         || (direction != SE_UP && direction != SE_DOWN))
@@ -76,30 +155,32 @@ static void bg_se_copy_or_move_rect_1_tile_vert(u16 bg_sbb, Rect se_rect, int di
 
     for (int y = start; y != end - direction; y -= direction)
     {
-        memcpy16(&(se_mat[bg_sbb][y + direction][se_rect.left]),
-                 &se_mat[bg_sbb][y][se_rect.left],
+        memcpy16(&rows[y + direction][se_rect.left],
+                 &rows[y][se_rect.left],
                  rect_width(&se_rect));
     }
 
     if (move)
     {
-        memset16(&se_mat[bg_sbb][end][se_rect.left], 0x0000, rect_width(&se_rect));
+        memset16(&rows[end][se_rect.left], 0x0000, rect_width(&se_rect));
     }
 }
 
 static void main_bg_se_copy_or_move_rect_1_tile_vert(Rect se_rect, int direction, bool move)
 {
-   bg_se_copy_or_move_rect_1_tile_vert(MAIN_BG_SBB, se_rect, direction, move);
+    bg_se_copy_or_move_rect_1_tile_vert(main_bg_se_shadow, se_rect, direction, move);
+    // The rows it was copied to and the one it moved out of
+    main_bg_se_mark_rows_dirty(se_rect.top - 1, se_rect.bottom + 1);
 }
 
 void bg_se_copy_rect_1_tile_vert(u16 bg_sbb, Rect se_rect, int direction)
 {
-    bg_se_copy_or_move_rect_1_tile_vert(MAIN_BG_SBB, se_rect, direction, false);
+    bg_se_copy_or_move_rect_1_tile_vert(se_mat[bg_sbb], se_rect, direction, false);
 }
 
 void bg_se_move_rect_1_tile_vert(u16 bg_sbb, Rect se_rect, int direction)
 {
-    bg_se_copy_or_move_rect_1_tile_vert(MAIN_BG_SBB, se_rect, direction, true);
+    bg_se_copy_or_move_rect_1_tile_vert(se_mat[bg_sbb], se_rect, direction, true);
 }
 
 void main_bg_se_copy_rect_1_tile_vert(Rect se_rect, int direction)
@@ -112,6 +193,127 @@ void main_bg_se_move_rect_1_tile_vert(Rect se_rect, int direction)
     main_bg_se_copy_or_move_rect_1_tile_vert(se_rect, direction, true);
 }
 
+void main_bg_se_copy_rect_n_tiles_vert(Rect se_rect, int direction, int num_tiles)
+{
+    if (se_rect.left > se_rect.right || num_tiles <= 0
+        || (direction != SE_UP && direction != SE_DOWN))
+    {
+        return;
+    }
+
+    clip_se_rect_within_step_of_full_screen_vert(&se_rect, direction);
+    int width = rect_width(&se_rect);
+
+    // Each single step copies the rect over the row past its leading edge and leaves
+    // the trailing edge row in place, so the rows it leaves behind all end up as that row
+    if (direction == SE_UP)
+    {
+        int y = se_rect.top - 1;
+        for (; y <= se_rect.bottom - num_tiles; y++)
+        {
+            memcpy16(&main_bg_se_shadow[y][se_rect.left], &main_bg_se_shadow[y + num_tiles][se_rect.left], width);
+        }
+        for (; y < se_rect.bottom; y++)
+        {
+            memcpy16(&main_bg_se_shadow[y][se_rect.left], &main_bg_se_shadow[se_rect.bottom][se_rect.left], width);
+        }
+    }
+    else
+    {
+        int y = se_rect.bottom + 1;
+        for (; y >= se_rect.top + num_tiles; y--)
+        {
+            memcpy16(&main_bg_se_shadow[y][se_rect.left], &main_bg_se_shadow[y - num_tiles][se_rect.left], width);
+        }
+        for (; y > se_rect.top; y--)
+        {
+            memcpy16(&main_bg_se_shadow[y][se_rect.left], &main_bg_se_shadow[se_rect.top][se_rect.left], width);
+        }
+    }
+
+    main_bg_se_mark_rows_dirty(se_rect.top - 1, se_rect.bottom + 1);
+}
+
+void main_bg_se_slide_down_step(Rect src_rect, int num_rows_shown)
+{
+    if (num_rows_shown <= 0 || num_rows_shown > rect_height(&src_rect))
+        return;
+
+    if (num_rows_shown > 1)
+    {
+        Rect shown_rect = { src_rect.left, 0, src_rect.right, num_rows_shown - 2 };
+        main_bg_se_copy_rect_1_tile_vert(shown_rect, SE_DOWN);
+    }
+
+    int next_row = src_rect.bottom - num_rows_shown + 1;
+    Rect next_row_rect = { src_rect.left, next_row, src_rect.right, next_row };
+    BG_POINT top_left = { src_rect.left, 0 };
+    main_bg_se_copy_rect(next_row_rect, top_left);
+}
+
+// The row of the rect that row y shows after num_steps single tile copies or moves up,
+// UNDEFINED if it's one a move left empty
+static int slide_up_src_row(const Rect *se_rect, int y, int num_steps, bool move)
+{
+    int src = y + num_steps;
+    if (src <= se_rect->bottom)
+        return src;
+    return move ? UNDEFINED : se_rect->bottom;
+}
+
+void main_bg_se_slide_up_step(Rect se_rect, int step, bool move)
+{
+    if (se_rect.left > se_rect.right || step <= 0)
+        return;
+
+    clip_se_rect_within_step_of_full_screen_vert(&se_rect, SE_UP);
+    int width = rect_width(&se_rect);
+    int visible_bottom = min(se_rect.bottom, MAIN_BG_VISIBLE_ROWS - 1);
+    if (se_rect.top - 1 > visible_bottom)
+        return; // Nothing on screen, main_bg_se_slide_up_finish() does it all
+
+    for (int y = se_rect.top - 1; y < visible_bottom; y++)
+    {
+        memcpy16(&main_bg_se_shadow[y][se_rect.left], &main_bg_se_shadow[y + 1][se_rect.left], width);
+    }
+
+    // The rows below the screen haven't moved yet so the new bottom row is read straight from where it started
+    int src = slide_up_src_row(&se_rect, visible_bottom, step, move);
+    if (src == UNDEFINED)
+    {
+        memset16(&main_bg_se_shadow[visible_bottom][se_rect.left], 0x0000, width);
+    }
+    else if (src != visible_bottom)
+    {
+        memcpy16(&main_bg_se_shadow[visible_bottom][se_rect.left], &main_bg_se_shadow[src][se_rect.left], width);
+    }
+
+    main_bg_se_mark_rows_dirty(se_rect.top - 1, visible_bottom);
+}
+
+void main_bg_se_slide_up_finish(Rect se_rect, int num_steps, bool move)
+{
+    if (se_rect.left > se_rect.right || num_steps <= 0)
+        return;
+
+    clip_se_rect_within_step_of_full_screen_vert(&se_rect, SE_UP);
+    int width = rect_width(&se_rect);
+
+    // Going down each row reads from rows below it that haven't been written yet
+    for (int y = max(se_rect.top - 1, MAIN_BG_VISIBLE_ROWS); y <= se_rect.bottom; y++)
+    {
+        int src = slide_up_src_row(&se_rect, y, num_steps, move);
+        if (src == UNDEFINED)
+        {
+            memset16(&main_bg_se_shadow[y][se_rect.left], 0x0000, width);
+        }
+        else if (src != y)
+        {
+            memcpy16(&main_bg_se_shadow[y][se_rect.left], &main_bg_se_shadow[src][se_rect.left], width);
+        }
+    }
+}
+
 void main_bg_se_copy_rect(Rect se_rect, BG_POINT pos)
 {
     if (se_rect.left > se_rect.right || se_rect.top > se_rect.bottom)
@@ -128,7 +330,7 @@ void main_bg_se_copy_rect(Rect se_rect, BG_POINT pos)
     for (int sy = 0; sy < height; sy++)
     {
         memcpy16(&tile_map[sy][0],
-                 &se_mat[MAIN_BG_SBB][se_rect.top + sy][se_rect.left], 
+                 &main_bg_se_shadow[se_rect.top + sy][se_rect.left],
                  width);
     }
     
@@ -136,10 +338,11 @@ void main_bg_se_copy_rect(Rect se_rect, BG_POINT pos)
     // Copy the tilemap to the new rect position
     for (int sy = 0; sy < height; sy++)
     {
-        memcpy16(&se_mat[MAIN_BG_SBB][pos.y + sy][pos.x],
+        memcpy16(&main_bg_se_shadow[pos.y + sy][pos.x],
                  &tile_map[sy][0],
                  width);
     }
+    main_bg_se_mark_rows_dirty(pos.y, pos.y + height - 1);
 }
 
 void main_bg_se_fill_rect_with_se(SE se, Rect se_rect)
@@ -155,24 +358,25 @@ void main_bg_se_fill_rect_with_se(SE se, Rect se_rect)
 
     for (int sy = 0; sy < height; sy++)
     {
-        memset16(&se_mat[MAIN_BG_SBB][se_rect.top + sy][se_rect.left], se, width);
+        memset16(&main_bg_se_shadow[se_rect.top + sy][se_rect.left], se, width);
     }
+    main_bg_se_mark_rows_dirty(se_rect.top, se_rect.top + height - 1);
 }
 
 // Helper: Copy the corners of a 3x3 tile block
 static void main_bg_se_expand_3x3_copy_corners(const Rect* se_dest_rect, const BG_POINT* src_top_left_pnt, int dest_rect_width, int dest_rect_height)
 {
-    SE top_left_se = se_mat[MAIN_BG_SBB][src_top_left_pnt->y][src_top_left_pnt->x];
-    se_mat[MAIN_BG_SBB][se_dest_rect->top][se_dest_rect->left] = top_left_se;
+    SE top_left_se = main_bg_se_shadow[src_top_left_pnt->y][src_top_left_pnt->x];
+    main_bg_se_shadow[se_dest_rect->top][se_dest_rect->left] = top_left_se;
 
-    SE top_right_se = se_mat[MAIN_BG_SBB][src_top_left_pnt->y][src_top_left_pnt->x + 2];
-    se_mat[MAIN_BG_SBB][se_dest_rect->top][se_dest_rect->left + dest_rect_width - 1] = top_right_se;
+    SE top_right_se = main_bg_se_shadow[src_top_left_pnt->y][src_top_left_pnt->x + 2];
+    main_bg_se_shadow[se_dest_rect->top][se_dest_rect->left + dest_rect_width - 1] = top_right_se;
 
-    SE bottom_left_se = se_mat[MAIN_BG_SBB][src_top_left_pnt->y + 2][src_top_left_pnt->x];
-    se_mat[MAIN_BG_SBB][se_dest_rect->top + dest_rect_height - 1][se_dest_rect->left] = bottom_left_se;
+    SE bottom_left_se = main_bg_se_shadow[src_top_left_pnt->y + 2][src_top_left_pnt->x];
+    main_bg_se_shadow[se_dest_rect->top + dest_rect_height - 1][se_dest_rect->left] = bottom_left_se;
 
-    SE bottom_right_se = se_mat[MAIN_BG_SBB][src_top_left_pnt->y + 2][src_top_left_pnt->x + 2];
-    se_mat[MAIN_BG_SBB][se_dest_rect->top + dest_rect_height - 1][se_dest_rect->left + dest_rect_width - 1] = bottom_right_se;
+    SE bottom_right_se = main_bg_se_shadow[src_top_left_pnt->y + 2][src_top_left_pnt->x + 2];
+    main_bg_se_shadow[se_dest_rect->top + dest_rect_height - 1][se_dest_rect->left + dest_rect_width - 1] = bottom_right_se;
 }
 
 // Helper: Copy the top and bottom sides of a 3x3 tile block
@@ -180,22 +384,22 @@ static void main_bg_se_expand_3x3_copy_top_bottom(const Rect* se_dest_rect, cons
 {
     if (dest_rect_width > 2)
     {
-        SE top_middle_se = se_mat[MAIN_BG_SBB][src_top_left_pnt->y][src_top_left_pnt->x + 1];
-        SE bottom_middle_se = se_mat[MAIN_BG_SBB][src_top_left_pnt->y + 2][src_top_left_pnt->x + 1];
-        memset16(&se_mat[MAIN_BG_SBB][se_dest_rect->top][se_dest_rect->left + 1], top_middle_se, dest_rect_width - 2);
-        memset16(&se_mat[MAIN_BG_SBB][se_dest_rect->bottom][se_dest_rect->left + 1], bottom_middle_se, dest_rect_width - 2);
+        SE top_middle_se = main_bg_se_shadow[src_top_left_pnt->y][src_top_left_pnt->x + 1];
+        SE bottom_middle_se = main_bg_se_shadow[src_top_left_pnt->y + 2][src_top_left_pnt->x + 1];
+        memset16(&main_bg_se_shadow[se_dest_rect->top][se_dest_rect->left + 1], top_middle_se, dest_rect_width - 2);
+        memset16(&main_bg_se_shadow[se_dest_rect->bottom][se_dest_rect->left + 1], bottom_middle_se, dest_rect_width - 2);
     }
 }
 
 // Helper: Copy the left and right sides of a 3x3 tile block
 static void main_bg_se_expand_3x3_copy_left_right(const Rect* se_dest_rect, const BG_POINT* src_top_left_pnt, int dest_rect_width, int dest_rect_height)
 {
-    SE middle_left_se = se_mat[MAIN_BG_SBB][src_top_left_pnt->y + 1][src_top_left_pnt->x];
-    SE middle_right_se = se_mat[MAIN_BG_SBB][src_top_left_pnt->y + 1][src_top_left_pnt->x + 2];
+    SE middle_left_se = main_bg_se_shadow[src_top_left_pnt->y + 1][src_top_left_pnt->x];
+    SE middle_right_se = main_bg_se_shadow[src_top_left_pnt->y + 1][src_top_left_pnt->x + 2];
     for (int y = 1;  y < dest_rect_height - 1; y++)
     {
-        se_mat[MAIN_BG_SBB][se_dest_rect->top + y][se_dest_rect->left] = middle_left_se;
-        se_mat[MAIN_BG_SBB][se_dest_rect->top + y][se_dest_rect->left + dest_rect_width - 1] = middle_right_se;
+        main_bg_se_shadow[se_dest_rect->top + y][se_dest_rect->left] = middle_left_se;
+        main_bg_se_shadow[se_dest_rect->top + y][se_dest_rect->left + dest_rect_width - 1] = middle_right_se;
     }
 }
 
@@ -220,11 +424,12 @@ void main_bg_se_copy_expand_3x3_rect(Rect se_dest_rect, BG_POINT src_top_left_pn
 
     // Copy left and right sides
     main_bg_se_expand_3x3_copy_left_right(&se_dest_rect, &src_top_left_pnt, dest_rect_width, dest_rect_height);
+    main_bg_se_mark_rows_dirty(se_dest_rect.top, se_dest_rect.top + dest_rect_height - 1);
 
     // Fill the center if needed
     if (dest_rect_width > 2 && dest_rect_height > 2)
     {
-        SE middle_fill_se = se_mat[MAIN_BG_SBB][src_top_left_pnt.y + 1][src_top_left_pnt.x + 1];
+        SE middle_fill_se = main_bg_se_shadow[src_top_left_pnt.y + 1][src_top_left_pnt.x + 1];
         Rect dest_inner_fill_rect = {se_dest_rect.left + 1, se_dest_rect.top + 1, se_dest_rect.right - 1, se_dest_rect.bottom - 1};
         main_bg_se_fill_rect_with_se(middle_fill_se, dest_inner_fill_rect);
     }
@@ -12,10 +12,27 @@
 #include <string.h>
 
 #include "pool.h"
+#include "vram_queue.h"
+#include "pal_bank.h"
 
 #define JOKER_SCORE_TEXT_Y 48
-#define NUM_JOKERS_PER_SPRITESHEET 2
-#define MAX_DEFINABLE_JOKERS 150
+
+// Edition effects, applied when the joker is scored independently
+#define FOIL_EDITION_CHIPS 50
+#define HOLO_EDITION_MULT 10
+#define POLY_EDITION_XMULT_NUM 3 // X1.5 mult
+#define POLY_EDITION_XMULT_DEN 2
+
+// Edition odds out of 1000, from Balatro
+#define FOIL_EDITION_ODDS 20
+#define HOLO_EDITION_ODDS 14
+#define POLY_EDITION_ODDS 3
+#define NEGATIVE_EDITION_ODDS 3
+
+// The edition shimmer sweeps the palette of the joker towards a tint and back
+#define EDITION_SHIMMER_SPEED 0x400 // Angle step per frame, a full cycle is 0x10000
+#define EDITION_SHIMMER_MAX_ALPHA 12 // Out of 32
+#define POLY_RAINBOW_STEP_FRAMES 16
 
 static const unsigned int *joker_gfxTiles[] =
 {
@@ -30,6 +47,19 @@ static const unsigned short *joker_gfxPal[] =
 #undef DEF_JOKER_GFX
 };
 
+// Jokers are packed into the spritesheets by palette by scripts/pack_joker_sheets.py
+typedef struct
+{
+    u8 sheet;
+    u8 slot; // Position of the joker in the sheet
+} JokerSheetPos;
+
+static const JokerSheetPos joker_sheet_map[] =
+{
+#define DEF_JOKER_SHEET_POS(sheet, slot) { sheet, slot },
+#include "../include/def_joker_sheet_map.h"
+#undef DEF_JOKER_SHEET_POS
+};
 const static u8 edition_price_lut[MAX_EDITIONS] =
 {
     0, // BASE_EDITION
@@ -49,99 +79,206 @@ const static u8 edition_price_lut[MAX_EDITIONS] =
 static bool used_layers[MAX_JOKER_OBJECTS] = {false}; // Track used layers for joker sprites
 // TODO: Refactor sorting into SpriteObject?
 
-// Maps the spritesheet index to the palette bank index allocated to it.
-// Spritesheets that were not allocated are
-static int joker_spritesheet_pb_map[(MAX_DEFINABLE_JOKERS + 1) / NUM_JOKERS_PER_SPRITESHEET];
-static int joker_pb_num_sprite_users[JOKER_LAST_PB - JOKER_BASE_PB + 1] = { 0 };
+// The palette banks come from pal_bank.c, the edition is the variant so each edition gets
+// its own bank and the edition shimmer doesn't affect other jokers.
+// These track which banks show jokers and what's in them so they can be animated.
+static int joker_pb_num_sprite_users[NUM_PALETTES] = { 0 };
+static int joker_pb_spritesheet[NUM_PALETTES];
+static u8 joker_pb_edition[NUM_PALETTES];
 
-static int get_num_spritesheets()
+static const COLOR edition_tint_lut[MAX_EDITIONS] =
 {
-    return (get_joker_registry_size() + NUM_JOKERS_PER_SPRITESHEET - 1) / NUM_JOKERS_PER_SPRITESHEET;
-}
+    CLR_BLACK,              // BASE_EDITION, no shimmer
+    RGB15(24, 26, 31),      // FOIL_EDITION, silvery blue
+    RGB15(31, 12, 20),      // HOLO_EDITION, pinkish red
+    CLR_BLACK,              // POLY_EDITION, cycles through poly_rainbow_lut instead
+    CLR_BLACK,              // NEGATIVE_EDITION, inverted once when allocated
+};
 
-static int joker_get_spritesheet_idx(u8 joker_id)
+static const COLOR poly_rainbow_lut[] =
+{
+    RGB15(31, 0, 0), RGB15(31, 31, 0), RGB15(0, 31, 0), RGB15(0, 31, 31), RGB15(0, 0, 31), RGB15(31, 0, 31)
+};
+
+static uint edition_shimmer_frame = 0;
+
+// Compact icon tiles are shared by all the jokers with the same ID
+static int joker_icon_ids[MAX_JOKER_ICONS];
+static int joker_icon_num_users[MAX_JOKER_ICONS] = { 0 };
 
+static int joker_get_spritesheet_idx(u8 joker_id)
 {
-    return joker_id / NUM_JOKERS_PER_SPRITESHEET;
+    return joker_sheet_map[joker_id].sheet;
 }
 
-// TODO: This should be generalized so any sprite can have dynamic swapping
-static void joker_pb_add_sprite_user(int pb)
+static const unsigned int *joker_get_tiles(u8 joker_id)
 {
-    joker_pb_num_sprite_users[pb - JOKER_BASE_PB]++;
+    const JokerSheetPos *pos = &joker_sheet_map[joker_id];
+    return &joker_gfxTiles[pos->sheet][pos->slot * TILE_SIZE * JOKER_SPRITE_OFFSET];
 }
 
-static void joker_pb_remove_sprite_user(int pb)
+// Each joker object holds one user of its palette bank, released by joker_pb_release()
+static int joker_pb_acquire(u8 joker_id, u8 edition)
 {
-    int num_sprite_users = joker_pb_num_sprite_users[pb - JOKER_BASE_PB];
-    joker_pb_num_sprite_users[pb - JOKER_BASE_PB] = max(0, num_sprite_users - 1);
+    int joker_spritesheet_idx = joker_get_spritesheet_idx(joker_id);
+    bool is_new = false;
+    int joker_pb = pal_bank_acquire(PAL_BANK_OBJ, joker_gfxPal[joker_spritesheet_idx], edition, &is_new);
+
+    if (joker_pb == UNDEFINED)
+    {
+        // Out of palette banks, share one with another joker so it's at least visible
+        for (int i = 0; i < NUM_PALETTES && joker_pb == UNDEFINED; i++)
+        {
+            if (joker_pb_num_sprite_users[i] > 0)
+            {
+                joker_pb = i;
+            }
+        }
+
+        if (joker_pb == UNDEFINED)
+            return 0; // Every bank is taken by something else, this can't happen with the current sprites
+
+        pal_bank_add_user(PAL_BANK_OBJ, joker_pb);
+    }
+    else
+    {
+        // The bank has the same colors and variant so this is right even if it was shared
+        joker_pb_spritesheet[joker_pb] = joker_spritesheet_idx;
+        joker_pb_edition[joker_pb] = edition;
+
+        if (is_new && edition == NEGATIVE_EDITION)
+        {
+            COLOR *colors = pal_bank_edit(PAL_BANK_OBJ, joker_pb);
+            // Skip the transparent color
+            for (int i = 1; i < PAL_ROW_LEN; i++)
+            {
+                colors[i] ^= CLR_WHITE;
+            }
+        }
+    }
+
+    joker_pb_num_sprite_users[joker_pb]++;
+    return joker_pb;
 }
 
-static int joker_pb_get_num_sprite_users(int joker_pb)
+static void joker_pb_release(int joker_pb)
 {
-    return joker_pb_num_sprite_users[joker_pb - JOKER_BASE_PB];
+    joker_pb_num_sprite_users[joker_pb] = max(0, joker_pb_num_sprite_users[joker_pb] - 1);
+    pal_bank_release(PAL_BANK_OBJ, joker_pb);
 }
 
-static int get_unused_joker_pb()
+// Halves a 32x32 4bpp joker sprite into a 16x16 icon by keeping every other pixel.
+// Both are laid out as 1D mapped tiles.
+static void joker_downsample_to_icon(const u32 *src_tiles, u32 *dst_tiles)
 {
-    for (int i = 0; i < NUM_ELEM_IN_ARR(joker_pb_num_sprite_users); i++)
+    const int src_tiles_per_row = CARD_SPRITE_SIZE / TILE_SIZE;
+    const int dst_tiles_per_row = src_tiles_per_row / 2;
+
+    for (int dst_tile = 0; dst_tile < JOKER_ICON_SPRITE_OFFSET; dst_tile++)
     {
-        if (joker_pb_num_sprite_users[i] == 0)
+        int dst_tile_x = dst_tile % dst_tiles_per_row;
+        int dst_tile_y = dst_tile / dst_tiles_per_row;
+
+        for (int row = 0; row < TILE_SIZE; row++)
         {
-            return (i + JOKER_BASE_PB);
+            int src_tile_y = dst_tile_y * 2 + (row * 2) / TILE_SIZE;
+            int src_row = (row * 2) % TILE_SIZE;
+            u32 dst_row = 0;
+
+            for (int col = 0; col < TILE_SIZE; col++)
+            {
+                int src_tile_x = dst_tile_x * 2 + (col * 2) / TILE_SIZE;
+                int src_col = (col * 2) % TILE_SIZE;
+                u32 src_row_pixels = src_tiles[(src_tile_y * src_tiles_per_row + src_tile_x) * TILE_SIZE + src_row];
+
+                dst_row |= ((src_row_pixels >> (src_col * 4)) & 0xF) << (col * 4);
+            }
+
+            dst_tiles[dst_tile * TILE_SIZE + row] = dst_row;
         }
     }
-
-    return UNDEFINED;
 }
 
-static int allocate_pb_if_needed(u8 joker_id)
+// Returns the tile index of the icon for this joker ID, creating it if it doesn't exist yet
+static int joker_icon_acquire(u8 joker_id)
 {
-    int joker_spritesheet_idx = joker_get_spritesheet_idx(joker_id);
-    int joker_pb = joker_spritesheet_pb_map[joker_spritesheet_idx];
-    if (joker_pb != UNDEFINED)
+    int free_icon = UNDEFINED;
+    for (int i = 0; i < MAX_JOKER_ICONS; i++)
     {
-        // Already allocated
-        return joker_pb;
+        if (joker_icon_num_users[i] > 0 && joker_icon_ids[i] == joker_id)
+        {
+            joker_icon_num_users[i]++;
+            return JOKER_ICON_TID + i * JOKER_ICON_SPRITE_OFFSET;
+        }
+
+        if (free_icon == UNDEFINED && joker_icon_num_users[i] == 0)
+        {
+            free_icon = i;
+        }
     }
-    
-    // Allocate a new palette
-    joker_pb = get_unused_joker_pb();
 
-    if (joker_pb == UNDEFINED)
+    if (free_icon == UNDEFINED)
     {
-        // Ran out of palettes, default to base and pray
-        joker_pb = JOKER_BASE_PB;
+        return UNDEFINED;
     }
-    else
+
+    u32 icon_tiles[TILE_SIZE * JOKER_ICON_SPRITE_OFFSET];
+    joker_downsample_to_icon(joker_get_tiles(joker_id), icon_tiles);
+
+    int tile_index = JOKER_ICON_TID + free_icon * JOKER_ICON_SPRITE_OFFSET;
+    memcpy32(&tile_mem[4][tile_index], icon_tiles, TILE_SIZE * JOKER_ICON_SPRITE_OFFSET);
+
+    joker_icon_ids[free_icon] = joker_id;
+    joker_icon_num_users[free_icon] = 1;
+
+    return tile_index;
+}
+
+static void joker_icon_release(u8 joker_id)
+{
+    for (int i = 0; i < MAX_JOKER_ICONS; i++)
     {
-        joker_spritesheet_pb_map[joker_spritesheet_idx] = joker_pb;
-        memcpy16(&pal_obj_mem[PAL_ROW_LEN * joker_pb], joker_gfxPal[joker_spritesheet_idx], NUM_ELEM_IN_ARR(joker_gfx0Pal));
+        if (joker_icon_num_users[i] > 0 && joker_icon_ids[i] == joker_id)
+        {
+            joker_icon_num_users[i]--;
+            return;
+        }
     }
-    
-    return joker_pb;
 }
 
 void joker_init()
 {
-    // This should init once only so no need to free
-    int num_spritesheets = get_num_spritesheets();
-
-    for (int i = 0; i < num_spritesheets; i++)
+    for (int i = 0; i < MAX_JOKER_ICONS; i++)
     {
-        joker_spritesheet_pb_map[i] = UNDEFINED;
+        joker_icon_ids[i] = UNDEFINED;
     }
 }
 
-Joker *joker_new(u8 id)
+u8 joker_roll_edition(void)
 {
-    if (id >= get_joker_registry_size()) return NULL;
+#ifdef TEST_JOKER_EDITION // Allow forcing an edition on every joker to test it
+    return TEST_JOKER_EDITION;
+#else
+    int roll = random() % 1000;
+
+    if ((roll -= NEGATIVE_EDITION_ODDS) < 0) return NEGATIVE_EDITION;
+    if ((roll -= POLY_EDITION_ODDS) < 0) return POLY_EDITION;
+    if ((roll -= HOLO_EDITION_ODDS) < 0) return HOLO_EDITION;
+    if ((roll -= FOIL_EDITION_ODDS) < 0) return FOIL_EDITION;
+
+    return BASE_EDITION;
+#endif
+}
+
+Joker *joker_new(u8 id, u8 edition)
+{
+    if (id >= get_joker_registry_size() || edition >= MAX_EDITIONS) return NULL;
 
     Joker *joker = POOL_GET(Joker);
     const JokerInfo *jinfo = get_joker_registry_entry(id);
 
     joker->id = id;
-    joker->modifier = BASE_EDITION; // TODO: Make this a parameter
+    joker->modifier = edition;
     joker->value = jinfo->base_value + edition_price_lut[joker->modifier];
     joker->rarity = jinfo->rarity;
     joker->processed = false;
@@ -155,10 +292,17 @@ void joker_destroy(Joker **joker)
     *joker = NULL;
 }
 
-JokerEffect joker_get_score_effect(Joker *joker, Card *scored_card)
+JokerEffectPacked joker_get_score_effect(Joker *joker, Card *scored_card)
 {
     const JokerInfo *jinfo = get_joker_registry_entry(joker->id);
-    if (!jinfo || jinfo->effect == NULL) return (JokerEffect){0};
+    if (!jinfo) return JOKER_EFFECT_NONE;
+
+    if (jinfo->rule.trigger != JOKER_TRIGGER_NONE)
+    {
+        return joker_rule_evaluate(&jinfo->rule, scored_card);
+    }
+
+    if (jinfo->effect == NULL) return JOKER_EFFECT_NONE;
 
     return jinfo->effect(joker, scored_card);
 }
@@ -190,31 +334,28 @@ JokerObject *joker_object_new(Joker *joker)
     }
 
     joker_object->joker = joker;
-    joker_object->sprite_object = sprite_object_new();
+    sprite_object_init(&joker_object->sprite_object);
+    joker_object->compact = false;
 
     int tile_index = JOKER_TID + (layer * JOKER_SPRITE_OFFSET);
     
-    int joker_spritesheet_idx = joker_get_spritesheet_idx(joker->id);
-    int joker_idx = joker->id % NUM_JOKERS_PER_SPRITESHEET;
-    int joker_pb = allocate_pb_if_needed(joker->id);
-    joker_pb_add_sprite_user(joker_pb);
+    int joker_pb = joker_pb_acquire(joker->id, joker->modifier);
 
-    memcpy32(&tile_mem[4][tile_index], &joker_gfxTiles[joker_spritesheet_idx][joker_idx * TILE_SIZE * JOKER_SPRITE_OFFSET], TILE_SIZE * JOKER_SPRITE_OFFSET);
+    u32 upload_ticket = vram_queue_push(&tile_mem[4][tile_index], joker_get_tiles(joker->id), TILE_SIZE * JOKER_SPRITE_OFFSET * sizeof(u32));
 
-    sprite_object_set_sprite
+    Sprite *sprite = sprite_new
     (
-        joker_object->sprite_object, 
-        sprite_new
-        (
-            ATTR0_SQUARE | ATTR0_4BPP | ATTR0_AFF, 
-            ATTR1_SIZE_32, 
-            tile_index, 
-            joker_pb,
-            JOKER_STARTING_LAYER + layer
-        )
+        ATTR0_SQUARE | ATTR0_4BPP | ATTR0_AFF, 
+        ATTR1_SIZE_32, 
+        tile_index, 
+        joker_pb,
+        JOKER_STARTING_LAYER + layer
     );
-
-    
+    if (sprite != NULL)
+    {
+        sprite_set_upload_ticket(sprite, upload_ticket);
+    }
+    sprite_object_set_sprite(&joker_object->sprite_object, sprite);
 
     return joker_object;
 }
@@ -225,47 +366,131 @@ void joker_object_destroy(JokerObject **joker_object)
 
     int layer = sprite_get_layer(joker_object_get_sprite(*joker_object)) - JOKER_STARTING_LAYER;
     used_layers[layer] = false;
-    joker_pb_remove_sprite_user(sprite_get_pb(joker_object_get_sprite(*joker_object)));
-    if (joker_pb_get_num_sprite_users((sprite_get_pb(joker_object_get_sprite(*joker_object)))) == 0)
+    if ((*joker_object)->compact)
     {
-        joker_spritesheet_pb_map[joker_get_spritesheet_idx((*joker_object)->joker->id)] = UNDEFINED;
+        joker_icon_release((*joker_object)->joker->id);
     }
+    joker_pb_release(sprite_get_pb(joker_object_get_sprite(*joker_object)));
 
-    sprite_object_destroy(&(*joker_object)->sprite_object); // Destroy the sprite
+    sprite_object_deinit(&(*joker_object)->sprite_object); // Destroy the sprite
     joker_destroy(&(*joker_object)->joker); // Destroy the joker
     POOL_FREE(JokerObject, *joker_object);
     *joker_object = NULL;
 }
 
+// Called once per frame, the colors are uploaded by pal_fx_draw() during VBlank.
+// The cost only depends on the number of allocated palette banks
+// since all the jokers of the same spritesheet and edition share one.
+void joker_palettes_update()
+{
+    edition_shimmer_frame++;
+
+    // Sweep between 0 and EDITION_SHIMMER_MAX_ALPHA
+    int alpha = ((lu_sin(edition_shimmer_frame * EDITION_SHIMMER_SPEED) + (1 << 12)) * EDITION_SHIMMER_MAX_ALPHA) >> 13;
+
+    COLOR poly_tint = CLR_BLACK;
+    int poly_step = edition_shimmer_frame / POLY_RAINBOW_STEP_FRAMES;
+    int poly_step_alpha = (edition_shimmer_frame % POLY_RAINBOW_STEP_FRAMES) * 32 / POLY_RAINBOW_STEP_FRAMES;
+    clr_blend
+    (
+        &poly_rainbow_lut[poly_step % NUM_ELEM_IN_ARR(poly_rainbow_lut)],
+        &poly_rainbow_lut[(poly_step + 1) % NUM_ELEM_IN_ARR(poly_rainbow_lut)],
+        &poly_tint,
+        1,
+        poly_step_alpha
+    );
+
+    for (int i = 0; i < NUM_PALETTES; i++)
+    {
+        if (joker_pb_num_sprite_users[i] == 0)
+            continue;
+
+        u8 edition = joker_pb_edition[i];
+        if (edition != FOIL_EDITION && edition != HOLO_EDITION && edition != POLY_EDITION)
+            continue;
+
+        COLOR tint = (edition == POLY_EDITION) ? poly_tint : edition_tint_lut[edition];
+        // Skip the transparent color
+        clr_fade(&joker_gfxPal[joker_pb_spritesheet[i]][1], tint, &pal_bank_edit(PAL_BANK_OBJ, i)[1], PAL_ROW_LEN - 1, alpha);
+    }
+}
+
 void joker_object_update(JokerObject *joker_object)
 {
-    CardObject *card_object = (CardObject *)joker_object;
-    card_object_update(card_object);
+    if (joker_object == NULL) return;
+    sprite_object_update(&joker_object->sprite_object);
+}
+
+void joker_object_set_compact(JokerObject *joker_object, bool compact)
+{
+    if (joker_object == NULL || joker_object->compact == compact)
+        return;
+
+    Sprite *sprite = joker_object_get_sprite(joker_object);
+    int sprite_index = sprite_get_layer(sprite);
+    int joker_pb = sprite_get_pb(sprite);
+    u16 a0 = ATTR0_SQUARE | ATTR0_4BPP;
+    u16 a1;
+    int tile_index;
+
+    if (compact)
+    {
+        tile_index = joker_icon_acquire(joker_object->joker->id);
+        if (tile_index == UNDEFINED)
+            return; // No room for another icon, keep the full size sprite
+
+        a1 = ATTR1_SIZE_16;
+    }
+    else
+    {
+        joker_icon_release(joker_object->joker->id);
+
+        // The full size tiles are still in place from when the joker object was created
+        tile_index = JOKER_TID + (sprite_index - JOKER_STARTING_LAYER) * JOKER_SPRITE_OFFSET;
+        a0 |= ATTR0_AFF;
+        a1 = ATTR1_SIZE_32;
+    }
+
+    // The old sprite goes first so its pool entry and affine matrix can be reused by the new one
+    sprite_destroy(&joker_object->sprite_object.sprite);
+    sprite_object_set_sprite(&joker_object->sprite_object, sprite_new(a0, a1, tile_index, joker_pb, sprite_index));
+    joker_object->compact = compact;
 }
 
 void joker_object_shake(JokerObject *joker_object, mm_word sound_id)
 {
-    sprite_object_shake(joker_object->sprite_object, sound_id);
+    sprite_object_shake(&joker_object->sprite_object, sound_id);
 }
 
 bool joker_object_score(JokerObject *joker_object, Card* scored_card, int *chips, int *mult, int *xmult, int *money, bool *retrigger)
 {
     if (joker_object->joker->processed == true) return false; // If the joker has already been processed, return false
 
-    JokerEffect joker_effect = joker_get_score_effect(joker_object->joker, scored_card);
+    JokerEffectPacked packed_effect = joker_get_score_effect(joker_object->joker, scored_card);
+
+    // Editions apply once, when the joker is scored independently
+    u8 edition = (scored_card == NULL) ? joker_object->joker->modifier : BASE_EDITION;
+    bool has_edition_effect = (edition == FOIL_EDITION || edition == HOLO_EDITION || edition == POLY_EDITION);
 
-    if (memcmp(&joker_effect, &(JokerEffect){0}, sizeof(JokerEffect)) != 0)
+    if (packed_effect != JOKER_EFFECT_NONE || has_edition_effect)
     {
+        JokerEffect joker_effect = joker_effect_unpack(packed_effect);
+
+        // Foil and Holo are added before the joker's own effect and Polychrome is applied after it
+        if (edition == FOIL_EDITION) joker_effect.chips += FOIL_EDITION_CHIPS;
+        if (edition == HOLO_EDITION) joker_effect.mult += HOLO_EDITION_MULT;
+
         *chips += joker_effect.chips;
         *mult += joker_effect.mult;
         *mult *= joker_effect.xmult > 0 ? joker_effect.xmult : 1; // if xmult is zero, DO NOT multiply by it
+        if (edition == POLY_EDITION) *mult = *mult * POLY_EDITION_XMULT_NUM / POLY_EDITION_XMULT_DEN;
         *money += joker_effect.money;
         // TODO: Retrigger
 
         const int joker_score_display_offset_px = (MAX_CARD_SCORE_STR_LEN + 1)*TTE_CHAR_SIZE;
         // + 1 For space
 
-        int cursorPosX = fx2int(joker_object->sprite_object->x) + 8; // Offset of 16 pixels to center the text on the card
+        int cursorPosX = fx2int(joker_object->sprite_object.x) + 8; // Offset of 16 pixels to center the text on the card
         if (joker_effect.chips > 0)
         {
             char score_buffer[INT_MAX_DIGITS + 2]; // For '+' and null terminator
@@ -293,6 +518,13 @@ bool joker_object_score(JokerObject *joker_object, Card* scored_card, int *chips
             tte_write(score_buffer);
             cursorPosX += joker_score_display_offset_px;
         }
+        if (edition == POLY_EDITION)
+        {
+            tte_set_pos(cursorPosX, JOKER_SCORE_TEXT_Y);
+            tte_set_special(0xE000); // Red
+            tte_write("X1.5");
+            cursorPosX += joker_score_display_offset_px;
+        }
         if (joker_effect.money > 0)
         {
             char score_buffer[INT_MAX_DIGITS + 2];
@@ -316,19 +548,19 @@ void joker_object_set_selected(JokerObject* joker_object, bool selected)
 {
     if (joker_object == NULL)
         return;
-    sprite_object_set_selected(joker_object->sprite_object, selected);
+    sprite_object_set_selected(&joker_object->sprite_object, selected);
 }
 
 bool joker_object_is_selected(JokerObject* joker_object)
 {
     if (joker_object == NULL)
         return false;
-    return sprite_object_is_selected(joker_object->sprite_object);
+    return sprite_object_is_selected(&joker_object->sprite_object);
 }
 
 Sprite* joker_object_get_sprite(JokerObject* joker_object)
 {
     if (joker_object == NULL)
         return NULL;
-    return sprite_object_get_sprite(joker_object->sprite_object);
+    return sprite_object_get_sprite(&joker_object->sprite_object);
 }
@@ -5,199 +5,95 @@
 #include "list.h"
 #include <stdlib.h>
 
-static JokerEffect default_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card == NULL) effect.mult = 4;
-    return effect;
-}
-
-static JokerEffect sinful_joker_effect(Card *scored_card, u8 sinful_suit) {
-    JokerEffect effect = {0};
-    if (scored_card != NULL && scored_card->suit == sinful_suit)
-        effect.mult = 3;
-    return effect;
-}
-
-static JokerEffect greedy_joker_effect(Joker *joker, Card *scored_card) {
-    return sinful_joker_effect(scored_card, DIAMONDS);
-}
-
-static JokerEffect lusty_joker_effect(Joker *joker, Card *scored_card) {
-    return sinful_joker_effect(scored_card, HEARTS);
-}
-
-static JokerEffect wrathful_joker_effect(Joker *joker, Card *scored_card) {
-    return sinful_joker_effect(scored_card, SPADES);
-}
-
-static JokerEffect gluttonous_joker_effect(Joker *joker, Card *scored_card) {
-    return sinful_joker_effect(scored_card, CLUBS);
-}
-
-static JokerEffect jolly_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
-
-    // This is really inefficient but the only way at the moment to check for whole-hand conditions
-    u8 suits[NUM_SUITS];
-    u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
-
-    if (hand_contains_n_of_a_kind(ranks) >= 2)
-        effect.mult = 8;
-    return effect;
-}
-
-static JokerEffect zany_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
-
-    u8 suits[NUM_SUITS];
-    u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
-
-    if (hand_contains_n_of_a_kind(ranks) >= 3)
-        effect.mult = 12;
-    return effect;
-}
-
-static JokerEffect mad_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
-
-    u8 suits[NUM_SUITS];
-    u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
-
-    if (hand_contains_two_pair(ranks))
-        effect.mult = 10;
-    return effect;
-}
-
-static JokerEffect crazy_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
-
-    u8 suits[NUM_SUITS];
-    u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
-
-    if (hand_contains_straight(ranks))
-        effect.mult = 12;
-    return effect;
-}
-
-static JokerEffect droll_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
-
-    u8 suits[NUM_SUITS];
-    u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
-
-    if (hand_contains_flush(suits))
-        effect.mult = 10;
-    return effect;
-}
-
-static JokerEffect sly_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
-
+// Evaluates whether the condition of a data driven joker rule holds
+static bool joker_rule_condition_met(const JokerRule *rule, Card *scored_card)
+{
     u8 suits[NUM_SUITS];
     u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
 
-    if (hand_contains_n_of_a_kind(ranks) >= 2)
-        effect.chips = 50;
-    return effect;
-}
-
-static JokerEffect wily_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
-
-    u8 suits[NUM_SUITS];
-    u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
-
-    if (hand_contains_n_of_a_kind(ranks) >= 3)
-        effect.chips = 100;
-    return effect;
-}
-
-static JokerEffect clever_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
+    switch (rule->condition)
+    {
+        case JOKER_COND_ALWAYS:
+            return true;
+        case JOKER_COND_CARD_SUIT_IS:
+            return scored_card->suit == rule->operand;
+        case JOKER_COND_CARD_RANK_IN:
+            return (RANK_BIT(scored_card->rank) & rule->operand) != 0;
+        case JOKER_COND_CARD_IS_FACE:
+            return card_is_face(scored_card);
+        case JOKER_COND_PLAYED_AT_MOST:
+            return get_played_top() + 1 <= rule->operand;
+        case JOKER_COND_DISCARDS_LEFT_IS:
+            return get_num_discards_remaining() == rule->operand;
+        case JOKER_COND_HANDS_LEFT_IS:
+            return get_num_hands_remaining() == rule->operand;
+        default:
+            break;
+    }
 
-    u8 suits[NUM_SUITS];
-    u8 ranks[NUM_RANKS];
+    // The remaining conditions are about the whole played hand
     get_played_distribution(ranks, suits);
 
-    if (hand_contains_two_pair(ranks))
-        effect.chips = 80;
-    return effect;
+    switch (rule->condition)
+    {
+        case JOKER_COND_HAND_N_OF_A_KIND:
+            return hand_contains_n_of_a_kind(ranks) >= rule->operand;
+        case JOKER_COND_HAND_TWO_PAIR:
+            return hand_contains_two_pair(ranks);
+        case JOKER_COND_HAND_STRAIGHT:
+            return hand_contains_straight(ranks);
+        case JOKER_COND_HAND_FLUSH:
+            return hand_contains_flush(suits);
+        default:
+            return false;
+    }
 }
 
-static JokerEffect devious_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
-
-    u8 suits[NUM_SUITS];
-    u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
-
-    if (hand_contains_straight(ranks))
-        effect.chips = 100;
-    return effect;
+static int joker_rule_get_scale(const JokerRule *rule)
+{
+    switch (rule->scaler)
+    {
+        case JOKER_SCALE_DISCARDS_LEFT:
+            return get_num_discards_remaining();
+        case JOKER_SCALE_DECK_SIZE:
+            return get_deck_top() + 1;
+        case JOKER_SCALE_JOKERS_HELD:
+            return list_get_size(get_jokers());
+        case JOKER_SCALE_MONEY:
+            return get_money();
+        case JOKER_SCALE_MONEY_PER_5:
+            return get_money() / 5;
+        default:
+            return 1;
+    }
 }
 
-static JokerEffect crafty_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
-
-    u8 suits[NUM_SUITS];
-    u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
-
-    if (hand_contains_flush(suits))
-        effect.chips = 80;
-    return effect;
-}
+JokerEffectPacked joker_rule_evaluate(const JokerRule *rule, Card *scored_card)
+{
+    // Independent rules only apply at the end-phase of scoring (card == NULL)
+    // and on-scored rules only apply while cards are being scored
+    bool independent = (rule->trigger == JOKER_TRIGGER_INDEPENDENT);
+    if (rule->trigger == JOKER_TRIGGER_NONE || independent != (scored_card == NULL))
+        return JOKER_EFFECT_NONE;
 
-static JokerEffect half_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
+    if (!joker_rule_condition_met(rule, scored_card))
+        return JOKER_EFFECT_NONE;
 
-    int played_size = get_played_top() + 1;
-    if (played_size <= 3) 
-        effect.mult = 20;
+    int scale = joker_rule_get_scale(rule);
 
-    return effect;
+    return joker_effect_pack(rule->chips * scale, rule->mult * scale, rule->xmult, rule->money, false);
 }
 
-static JokerEffect joker_stencil_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
+static JokerEffectPacked joker_stencil_effect(Joker *joker, Card *scored_card) {
     if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
+        return JOKER_EFFECT_NONE; // if card != null, we are not at the end-phase of scoring yet
 
     List* jokers = get_jokers();
 
     // +1 xmult per empty joker slot...
     int num_jokers = list_get_size(jokers);
 
-    effect.xmult = (MAX_JOKERS_HELD_SIZE) - num_jokers;
+    int xmult = get_joker_slots() - num_jokers;
 
     // ...and also each stencil_joker adds +1 xmult
     
@@ -205,110 +101,40 @@ static JokerEffect joker_stencil_effect(Joker *joker, Card *scored_card) {
     {
         JokerObject* joker_object = list_get(jokers, i);
         if (joker_object->joker->id == JOKER_STENCIL_ID)
-            effect.xmult++;
+            xmult++;
     }
 
-    return effect;
+    return joker_effect_pack(0, 0, xmult, 0, false);
 }
 
 #define MISPRINT_MAX_MULT 23
-static JokerEffect misprint_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
+static JokerEffectPacked misprint_joker_effect(Joker *joker, Card *scored_card) {
     if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
-
-    effect.mult = random() % (MISPRINT_MAX_MULT + 1);
-
-    return effect;
-}
-
-static JokerEffect walkie_talkie_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card == NULL)
-        return effect;
-
-    if (scored_card->rank == TEN || scored_card->rank == FOUR) {
-            effect.chips = 10;
-            effect.mult = 4;
-    }
-
-    return effect;
-}
-
-static JokerEffect fibonnaci_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card == NULL)
-        return effect;
+        return JOKER_EFFECT_NONE; // if card != null, we are not at the end-phase of scoring yet
 
-    switch (scored_card->rank) {
-        case ACE: case TWO: case THREE: case FIVE: case EIGHT:
-            effect.mult = 8;
-        default:
-            break;
-    }
-
-    return effect;
-}
-
-static JokerEffect banner_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
-
-    effect.chips = 30 * get_num_discards_remaining();
-
-    return effect;
-}
-
-static JokerEffect mystic_summit_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
-
-    if (get_num_discards_remaining() == 0)
-        effect.mult = 15;
-
-    return effect;
+    return joker_effect_pack(0, random() % (MISPRINT_MAX_MULT + 1), 0, 0, false);
 }
 
-static JokerEffect blackboard_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
+static JokerEffectPacked blackboard_joker_effect(Joker *joker, Card *scored_card) {
     if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
+        return JOKER_EFFECT_NONE; // if card != null, we are not at the end-phase of scoring yet
 
-    bool all_cards_are_spades_or_clubs = true;
     CardObject** hand = get_hand_array();
     int hand_size = hand_get_size();
     for (int i = 0; i < hand_size; i++ )
     {
         u8 suit = hand[i]->card->suit;
-        if (suit == HEARTS || suit == DIAMONDS) {
-            all_cards_are_spades_or_clubs = false;
-            break;
-        }
+        if (suit == HEARTS || suit == DIAMONDS)
+            return JOKER_EFFECT_NONE;
     }
 
-    if (all_cards_are_spades_or_clubs)
-        effect.xmult = 3;
-
-    return effect;
-}
-
-static JokerEffect blue_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
-
-    effect.chips = (get_deck_top() + 1) * 2;
-
-    return effect;
+    return joker_effect_pack(0, 0, 3, 0, false);
 }
 
-static JokerEffect raised_fist_joker_effect(Joker *joker, Card *scored_card) 
+static JokerEffectPacked raised_fist_joker_effect(Joker *joker, Card *scored_card) 
 {
-    JokerEffect effect = {0};
     if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
+        return JOKER_EFFECT_NONE; // if card != null, we are not at the end-phase of scoring yet
 
     // Find the lowest rank card in hand
     // Aces are always considered high value, even in an ace-low straight
@@ -322,266 +148,62 @@ static JokerEffect raised_fist_joker_effect(Joker *joker, Card *scored_card)
             lowest_value = value;
     }
 
-    if (lowest_value != IMPOSSIBLY_HIGH_CARD_VALUE)
-        effect.mult = lowest_value * 2;
+    if (lowest_value == IMPOSSIBLY_HIGH_CARD_VALUE)
+        return JOKER_EFFECT_NONE;
 
-    return effect;
+    return joker_effect_pack(0, lowest_value * 2, 0, 0, false);
 } 
 
-static JokerEffect reserved_parking_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
+static JokerEffectPacked reserved_parking_joker_effect(Joker *joker, Card *scored_card) {
     if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
+        return JOKER_EFFECT_NONE; // if card != null, we are not at the end-phase of scoring yet
 
+    int money = 0;
     CardObject** hand = get_hand_array();
     int hand_size = hand_get_size();
     for (int i = 0; i < hand_size; i++ )
     {
         if ((random() % 2 == 0) && card_is_face(hand[i]->card)) {
-            effect.money += 1;
+            money += 1;
         }
     }
 
-    return effect;
+    return joker_effect_pack(0, 0, 0, money, false);
 };
 
-static JokerEffect business_card_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card == NULL)
-        return effect;
-
-    if ((random() % 2 == 0) && card_is_face(scored_card)) {
-        effect.money = 2;
-    }
-
-    return effect;
-}
-
-static JokerEffect scholar_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card == NULL)
-        return effect;
-
-    if (scored_card->rank == ACE) {
-        effect.chips = 20;
-        effect.mult = 4;
-    }
-
-    return effect;
-}
-
-static JokerEffect scary_face_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
+static JokerEffectPacked business_card_joker_effect(Joker *joker, Card *scored_card) {
     if (scored_card == NULL)
-        return effect;
+        return JOKER_EFFECT_NONE;
 
-    if (card_is_face(scored_card)) {
-        effect.chips = 30;
-    }
+    if ((random() % 2 == 0) && card_is_face(scored_card))
+        return joker_effect_pack(0, 0, 0, 2, false);
 
-    return effect;
-}
-
-static JokerEffect abstract_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
-
-    // +1 xmult per occupied joker slot
-    int num_jokers = list_get_size(get_jokers());
-    effect.mult = num_jokers * 3;
-
-    return effect;
-}
-
-static JokerEffect bull_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
-
-    effect.chips = get_money() * 2;
-
-    return effect;
-}
-
-static JokerEffect smiley_face_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card == NULL)
-        return effect;
-
-    if (card_is_face(scored_card)) {
-        effect.mult = 5;
-    }
-
-    return effect;
-}
-
-static JokerEffect even_steven_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card == NULL)
-        return effect;
-
-    if (card_get_value(scored_card) % 2 == 0) {
-        switch (scored_card->rank) {
-            case KING: case QUEEN: case JACK:
-                break;
-            default:
-                effect.mult = 4;
-        }
-    }
-
-    return effect;
-}
-
-static JokerEffect odd_todd_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card == NULL)
-        return effect;
-
-    if (card_get_value(scored_card) % 2 == 1) // todo test ace
-        effect.chips = 31;
-
-    return effect;
-}
-
-__attribute__((unused))
-static JokerEffect acrobat_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card == NULL)
-        return effect;
-
-    // 0 remaining hands mean we're scoring the last hand
-    if (get_num_hands_remaining() == 0) {
-        effect.xmult = 3;
-    }
-
-    return effect;
-}
-
-static JokerEffect the_duo_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
-    
-     // This is really inefficient but the only way at the moment to check for whole-hand conditions
-    u8 suits[NUM_SUITS];
-    u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
-
-    if (hand_contains_n_of_a_kind(ranks) >= 2)
-        effect.xmult = 2;
-    return effect;
- }
-
-static JokerEffect the_trio_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
-    
-     // This is really inefficient but the only way at the moment to check for whole-hand conditions
-    u8 suits[NUM_SUITS];
-    u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
-
-    if (hand_contains_n_of_a_kind(ranks) >= 3)
-        effect.xmult = 3;
-    return effect;
- }
-
-static JokerEffect the_family_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
-    
-     // This is really inefficient but the only way at the moment to check for whole-hand conditions
-    u8 suits[NUM_SUITS];
-    u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
-
-    if (hand_contains_n_of_a_kind(ranks) >= 4)
-        effect.xmult = 4;
-    return effect;
- }
-
-static JokerEffect the_order_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
-
-    u8 suits[NUM_SUITS];
-    u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
-
-    if (hand_contains_straight(ranks))
-        effect.xmult = 3;
-    return effect;
-}
-
-static JokerEffect the_tribe_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
-
-    u8 suits[NUM_SUITS];
-    u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
-
-    if (hand_contains_flush(suits))
-        effect.xmult = 2;
-    return effect;
-}
-
-static JokerEffect bootstraps_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
-
-    effect.mult = (get_money() / 5) * 2;
-
-    return effect;
+    return JOKER_EFFECT_NONE;
 }
 
 // Using __attribute__((unused)) for jokers with no sprites yet to avoid warning
 // Remove the attribute once they have sprites
 // no graphics available but ready to be used if wanted when graphics available
 __attribute__((unused))
-static JokerEffect shoot_the_moon_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
+static JokerEffectPacked shoot_the_moon_joker_effect(Joker *joker, Card *scored_card) {
     if (scored_card != NULL)
-        return effect; // if card != null, we are not at the end-phase of scoring yet
+        return JOKER_EFFECT_NONE; // if card != null, we are not at the end-phase of scoring yet
         
+    int mult = 0;
     CardObject** hand = get_hand_array();
     int hand_size = hand_get_size();
     for (int i = 0; i < hand_size; i++ )
     {
         if (hand[i]->card->rank == QUEEN)
         {
-             effect.mult += 13;
+             mult += 13;
         }
     }
 
-    return effect;
+    return joker_effect_pack(0, mult, 0, 0, false);
 }
 
-// no graphics available but ready to be used if wanted when graphics available
-__attribute__((unused))
-static JokerEffect triboulet_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
-    if (scored_card == NULL)
-        return effect;
-
-    switch (scored_card->rank) {
-        case KING: case QUEEN:
-            effect.xmult = 2;
-        default:
-            break;
-    }
-
-    return effect;
-}
-
-static JokerEffect blueprint_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
+static JokerEffectPacked blueprint_joker_effect(Joker *joker, Card *scored_card) {
     List* jokers = get_jokers();
     int list_size = list_get_size(jokers);
     
@@ -589,16 +211,15 @@ static JokerEffect blueprint_joker_effect(Joker *joker, Card *scored_card) {
         JokerObject* curr_joker_object = list_get(jokers, i);
         if (curr_joker_object->joker == joker) {
             JokerObject* next_joker_object = list_get(jokers, i + 1);
-            effect = joker_get_score_effect(next_joker_object->joker, scored_card);
-            break;
+            return joker_get_score_effect(next_joker_object->joker, scored_card);
         }
     }
 
-    return effect;
+    return JOKER_EFFECT_NONE;
 }
 
-static JokerEffect brainstorm_joker_effect(Joker *joker, Card *scored_card) {
-    JokerEffect effect = {0};
+static JokerEffectPacked brainstorm_joker_effect(Joker *joker, Card *scored_card) {
+    JokerEffectPacked effect = JOKER_EFFECT_NONE;
     static bool in_brainstorm = false;
     if (in_brainstorm)
         return effect;
@@ -618,65 +239,78 @@ static JokerEffect brainstorm_joker_effect(Joker *joker, Card *scored_card) {
 
 /* The index of a joker in the registry matches its ID.
  * The joker sprites are matched by ID so the position in the registry
- * determines the joker's sprite.
- * Each consecutive NUM_JOKERS_PER_SPRITESHEET (defined in joker.c) jokers
- * share a spritesheet and thus a color palette.
- * To make better use of color palettes jokers may be rearranged here
- * (and put together in the matching spritesheet) to share a color palette.
- * Otherwise the order is similar to the wiki.
+ * determines the joker's sprite, graphics/jokers/joker_<id>.png.
+ * scripts/pack_joker_sheets.py groups the sprites into spritesheets by palette,
+ * so the order here doesn't affect palette use and is similar to the wiki.
+ *
+ * Most jokers are plain "if <condition> then +chips/+mult/Xmult/+money" rules
+ * and are declared as data with ON_SCORED() or INDEPENDENT(),
+ * chips and mult being multiplied by the scaler (see joker.h).
+ * Only jokers that can't be expressed this way use CUSTOM() with an effect function.
  */
+#define ON_SCORED(cond, operand, scaler, chips, mult, xmult, money) \
+    { JOKER_TRIGGER_ON_SCORED, cond, scaler, xmult, operand, chips, mult, money }, NULL
+#define INDEPENDENT(cond, operand, scaler, chips, mult, xmult, money) \
+    { JOKER_TRIGGER_INDEPENDENT, cond, scaler, xmult, operand, chips, mult, money }, NULL
+#define CUSTOM(effect_func) { JOKER_TRIGGER_NONE }, effect_func
+
+#define EVEN_RANKS (RANK_BIT(TWO) | RANK_BIT(FOUR) | RANK_BIT(SIX) | RANK_BIT(EIGHT) | RANK_BIT(TEN))
+#define ODD_RANKS (RANK_BIT(THREE) | RANK_BIT(FIVE) | RANK_BIT(SEVEN) | RANK_BIT(NINE) | RANK_BIT(ACE))
+#define FIBONACCI_RANKS (RANK_BIT(ACE) | RANK_BIT(TWO) | RANK_BIT(THREE) | RANK_BIT(FIVE) | RANK_BIT(EIGHT))
+
 const JokerInfo joker_registry[] = {
-    { COMMON_JOKER, 2, default_joker_effect },  // DEFAULT_JOKER_ID = 0
-    { COMMON_JOKER, 5, greedy_joker_effect },   // GREEDY_JOKER_ID  = 1
-    { COMMON_JOKER, 5, lusty_joker_effect },    // etc...  2  
-    { COMMON_JOKER, 5, wrathful_joker_effect },         // 3                  
-    { COMMON_JOKER, 5, gluttonous_joker_effect },       // 4               
-    { COMMON_JOKER, 3, jolly_joker_effect },            // 5              
-    { COMMON_JOKER, 4, zany_joker_effect },             // 6
-    { COMMON_JOKER, 4, mad_joker_effect },              // 7
-    { COMMON_JOKER, 4, crazy_joker_effect },            // 8
-    { COMMON_JOKER, 4, droll_joker_effect },            // 9
-    { COMMON_JOKER, 3, sly_joker_effect },              // 10
-    { COMMON_JOKER, 4, wily_joker_effect },             // 11
-    { COMMON_JOKER, 4, clever_joker_effect },           // 12 
-    { COMMON_JOKER, 4, devious_joker_effect },          // 13 
-    { COMMON_JOKER, 4, crafty_joker_effect },           // 14
-    { COMMON_JOKER, 5, half_joker_effect },             // 15
-    { UNCOMMON_JOKER, 8, joker_stencil_effect },        // 16
-    { COMMON_JOKER, 5, banner_joker_effect },           // 17
-    { COMMON_JOKER, 4, walkie_talkie_joker_effect },    // 18
-    { UNCOMMON_JOKER, 8, fibonnaci_joker_effect },      // 19
-    { UNCOMMON_JOKER, 6, blackboard_joker_effect },     // 20
-    { COMMON_JOKER, 5, mystic_summit_joker_effect },    // 21
-    { COMMON_JOKER, 4, misprint_joker_effect },         // 22 
-    { COMMON_JOKER, 4, even_steven_joker_effect },      // 23
-    { COMMON_JOKER, 5, blue_joker_effect },             // 24
-    { COMMON_JOKER, 4, odd_todd_joker_effect },         // 25
-    { COMMON_JOKER, 4, scholar_joker_effect },          // 26
-    { COMMON_JOKER, 4, business_card_joker_effect },    // 27
-    // Business card should be paired with Shortcut for palette optimization when it's added
-    { COMMON_JOKER, 4, scary_face_joker_effect },       // 28
-    { UNCOMMON_JOKER, 7, bootstraps_joker_effect},      // 29
-    { UNCOMMON_JOKER, 5, NULL /* Pareidolia */ },       // 30
-    { COMMON_JOKER, 6, reserved_parking_joker_effect }, // 31
-    { COMMON_JOKER, 4, abstract_joker_effect },         // 32
-    { UNCOMMON_JOKER, 6, bull_joker_effect},            // 33
-    { RARE_JOKER, 8, the_duo_joker_effect},             // 34
-    { RARE_JOKER, 8, the_trio_joker_effect},            // 35
-    { RARE_JOKER, 8, the_family_joker_effect},          // 36
-    { RARE_JOKER, 8, the_order_joker_effect},           // 37
-    { RARE_JOKER, 8, the_tribe_joker_effect},           // 38
-    { RARE_JOKER, 10, blueprint_joker_effect },         // 39
-    { RARE_JOKER, 10, brainstorm_joker_effect },        // 40
-    { COMMON_JOKER, 5, raised_fist_joker_effect },      // 41
-    { COMMON_JOKER, 4, smiley_face_joker_effect },      // 42
+    //                                  condition                    operand          scaler                     chips mult xmult money
+    { COMMON_JOKER, 2,   INDEPENDENT(JOKER_COND_ALWAYS,           0,               JOKER_SCALE_NONE,          0,   4,   0, 0) }, // DEFAULT_JOKER_ID = 0
+    { COMMON_JOKER, 5,   ON_SCORED  (JOKER_COND_CARD_SUIT_IS,     DIAMONDS,        JOKER_SCALE_NONE,          0,   3,   0, 0) }, // GREEDY_JOKER_ID  = 1
+    { COMMON_JOKER, 5,   ON_SCORED  (JOKER_COND_CARD_SUIT_IS,     HEARTS,          JOKER_SCALE_NONE,          0,   3,   0, 0) }, // Lusty, etc...  2
+    { COMMON_JOKER, 5,   ON_SCORED  (JOKER_COND_CARD_SUIT_IS,     SPADES,          JOKER_SCALE_NONE,          0,   3,   0, 0) }, // Wrathful 3
+    { COMMON_JOKER, 5,   ON_SCORED  (JOKER_COND_CARD_SUIT_IS,     CLUBS,           JOKER_SCALE_NONE,          0,   3,   0, 0) }, // Gluttonous 4
+    { COMMON_JOKER, 3,   INDEPENDENT(JOKER_COND_HAND_N_OF_A_KIND, 2,               JOKER_SCALE_NONE,          0,   8,   0, 0) }, // Jolly 5
+    { COMMON_JOKER, 4,   INDEPENDENT(JOKER_COND_HAND_N_OF_A_KIND, 3,               JOKER_SCALE_NONE,          0,  12,   0, 0) }, // Zany 6
+    { COMMON_JOKER, 4,   INDEPENDENT(JOKER_COND_HAND_TWO_PAIR,    0,               JOKER_SCALE_NONE,          0,  10,   0, 0) }, // Mad 7
+    { COMMON_JOKER, 4,   INDEPENDENT(JOKER_COND_HAND_STRAIGHT,    0,               JOKER_SCALE_NONE,          0,  12,   0, 0) }, // Crazy 8
+    { COMMON_JOKER, 4,   INDEPENDENT(JOKER_COND_HAND_FLUSH,       0,               JOKER_SCALE_NONE,          0,  10,   0, 0) }, // Droll 9
+    { COMMON_JOKER, 3,   INDEPENDENT(JOKER_COND_HAND_N_OF_A_KIND, 2,               JOKER_SCALE_NONE,         50,   0,   0, 0) }, // Sly 10
+    { COMMON_JOKER, 4,   INDEPENDENT(JOKER_COND_HAND_N_OF_A_KIND, 3,               JOKER_SCALE_NONE,        100,   0,   0, 0) }, // Wily 11
+    { COMMON_JOKER, 4,   INDEPENDENT(JOKER_COND_HAND_TWO_PAIR,    0,               JOKER_SCALE_NONE,         80,   0,   0, 0) }, // Clever 12
+    { COMMON_JOKER, 4,   INDEPENDENT(JOKER_COND_HAND_STRAIGHT,    0,               JOKER_SCALE_NONE,        100,   0,   0, 0) }, // Devious 13
+    { COMMON_JOKER, 4,   INDEPENDENT(JOKER_COND_HAND_FLUSH,       0,               JOKER_SCALE_NONE,         80,   0,   0, 0) }, // Crafty 14
+    { COMMON_JOKER, 5,   INDEPENDENT(JOKER_COND_PLAYED_AT_MOST,   3,               JOKER_SCALE_NONE,          0,  20,   0, 0) }, // Half 15
+    { UNCOMMON_JOKER, 8, CUSTOM(joker_stencil_effect) },                                                                      // Stencil 16
+    { COMMON_JOKER, 5,   INDEPENDENT(JOKER_COND_ALWAYS,           0,               JOKER_SCALE_DISCARDS_LEFT, 30,   0,   0, 0) }, // Banner 17
+    { COMMON_JOKER, 4,   ON_SCORED  (JOKER_COND_CARD_RANK_IN,     RANK_BIT(TEN) | RANK_BIT(FOUR), JOKER_SCALE_NONE, 10, 4, 0, 0) }, // Walkie Talkie 18
+    { UNCOMMON_JOKER, 8, ON_SCORED  (JOKER_COND_CARD_RANK_IN,     FIBONACCI_RANKS, JOKER_SCALE_NONE,          0,   8,   0, 0) }, // Fibonacci 19
+    { UNCOMMON_JOKER, 6, CUSTOM(blackboard_joker_effect) },                                                                   // Blackboard 20
+    { COMMON_JOKER, 5,   INDEPENDENT(JOKER_COND_DISCARDS_LEFT_IS, 0,               JOKER_SCALE_NONE,          0,  15,   0, 0) }, // Mystic Summit 21
+    { COMMON_JOKER, 4,   CUSTOM(misprint_joker_effect) },                                                                     // Misprint 22
+    { COMMON_JOKER, 4,   ON_SCORED  (JOKER_COND_CARD_RANK_IN,     EVEN_RANKS,      JOKER_SCALE_NONE,          0,   4,   0, 0) }, // Even Steven 23
+    { COMMON_JOKER, 5,   INDEPENDENT(JOKER_COND_ALWAYS,           0,               JOKER_SCALE_DECK_SIZE,     2,   0,   0, 0) }, // Blue 24
+    { COMMON_JOKER, 4,   ON_SCORED  (JOKER_COND_CARD_RANK_IN,     ODD_RANKS,       JOKER_SCALE_NONE,         31,   0,   0, 0) }, // Odd Todd 25
+    { COMMON_JOKER, 4,   ON_SCORED  (JOKER_COND_CARD_RANK_IN,     RANK_BIT(ACE),   JOKER_SCALE_NONE,         20,   4,   0, 0) }, // Scholar 26
+    { COMMON_JOKER, 4,   CUSTOM(business_card_joker_effect) },                                                                // Business Card 27
+    { COMMON_JOKER, 4,   ON_SCORED  (JOKER_COND_CARD_IS_FACE,     0,               JOKER_SCALE_NONE,         30,   0,   0, 0) }, // Scary Face 28
+    { UNCOMMON_JOKER, 7, INDEPENDENT(JOKER_COND_ALWAYS,           0,               JOKER_SCALE_MONEY_PER_5,   0,   2,   0, 0) }, // Bootstraps 29
+    { UNCOMMON_JOKER, 5, CUSTOM(NULL /* Pareidolia */) },                                                                     // 30
+    { COMMON_JOKER, 6,   CUSTOM(reserved_parking_joker_effect) },                                                             // Reserved Parking 31
+    { COMMON_JOKER, 4,   INDEPENDENT(JOKER_COND_ALWAYS,           0,               JOKER_SCALE_JOKERS_HELD,   0,   3,   0, 0) }, // Abstract 32
+    { UNCOMMON_JOKER, 6, INDEPENDENT(JOKER_COND_ALWAYS,           0,               JOKER_SCALE_MONEY,         2,   0,   0, 0) }, // Bull 33
+    { RARE_JOKER, 8,     INDEPENDENT(JOKER_COND_HAND_N_OF_A_KIND, 2,               JOKER_SCALE_NONE,          0,   0,   2, 0) }, // The Duo 34
+    { RARE_JOKER, 8,     INDEPENDENT(JOKER_COND_HAND_N_OF_A_KIND, 3,               JOKER_SCALE_NONE,          0,   0,   3, 0) }, // The Trio 35
+    { RARE_JOKER, 8,     INDEPENDENT(JOKER_COND_HAND_N_OF_A_KIND, 4,               JOKER_SCALE_NONE,          0,   0,   4, 0) }, // The Family 36
+    { RARE_JOKER, 8,     INDEPENDENT(JOKER_COND_HAND_STRAIGHT,    0,               JOKER_SCALE_NONE,          0,   0,   3, 0) }, // The Order 37
+    { RARE_JOKER, 8,     INDEPENDENT(JOKER_COND_HAND_FLUSH,       0,               JOKER_SCALE_NONE,          0,   0,   2, 0) }, // The Tribe 38
+    { RARE_JOKER, 10,    CUSTOM(blueprint_joker_effect) },                                                                    // Blueprint 39
+    { RARE_JOKER, 10,    CUSTOM(brainstorm_joker_effect) },                                                                   // Brainstorm 40
+    { COMMON_JOKER, 5,   CUSTOM(raised_fist_joker_effect) },                                                                  // Raised Fist 41
+    { COMMON_JOKER, 4,   ON_SCORED  (JOKER_COND_CARD_IS_FACE,     0,               JOKER_SCALE_NONE,          0,   5,   0, 0) }, // Smiley Face 42
 
     // The following jokers don't have sprites yet, 
     // uncomment them when their sprites are added.
 #if 0
 
-    { UNCOMMON_JOKER, 6, acrobat_joker_effect },
-    { COMMON_JOKER, 5, shoot_the_moon_joker_effect},
+    { UNCOMMON_JOKER, 6, ON_SCORED  (JOKER_COND_HANDS_LEFT_IS,    0,               JOKER_SCALE_NONE,          0,   0,   3, 0) }, // Acrobat
+    { COMMON_JOKER, 5,   CUSTOM(shoot_the_moon_joker_effect) },                                                               // Shoot the Moon
+    { LEGENDARY_JOKER, 20, ON_SCORED(JOKER_COND_CARD_RANK_IN,     RANK_BIT(KING) | RANK_BIT(QUEEN), JOKER_SCALE_NONE, 0, 0, 2, 0) }, // Triboulet
 #endif
 };
 
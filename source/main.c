@@ -9,6 +9,11 @@
 #include "joker.h"
 #include "affine_background.h"
 #include "graphic_utils.h"
+#include "benchmark.h"
+#include "quality.h"
+#include "vram_queue.h"
+#include "pal_bank.h"
+#include "pal_fx.h"
 
 // Graphics
 #include "background_gfx.h"
@@ -18,22 +23,71 @@
 #include "soundbank.h"
 #include "soundbank_bin.h"
 
+#define BOOT_FADE_FRAMES 30
+
+#ifdef DEBUG_STATS
+#define DEBUG_STATS_REFRESH_FRAMES 30
+#define DEBUG_STATS_X 72
+#define DEBUG_STATS_Y 0
+
+static uint oam_upload_cycles = 0;
+static uint update_cycles = 0; // Includes the time taken by interrupts during the update
+static uint se_commit_peak_bytes = 0; // Largest main background commit since the stats were shown
+
+// Prints the per frame stats in the empty strip above the joker panel
+static void draw_debug_stats()
+{
+    static int frame = 0;
+    if (++frame % DEBUG_STATS_REFRESH_FRAMES != 0) return;
+
+    tte_printf("#{P:%d,%d; cx:0x%X000}OAM %4uB %5uc", DEBUG_STATS_X, DEBUG_STATS_Y, TTE_WHITE_PB, sprite_get_oam_upload_bytes(), oam_upload_cycles);
+    // VRAM bytes of card tiles this round and of the last background change
+    tte_printf("#{P:%d,%d; cx:0x%X000}CARD %6u BG %5d", DEBUG_STATS_X, DEBUG_STATS_Y + TTE_CHAR_SIZE, TTE_WHITE_PB, card_get_tile_upload_bytes(), game_get_bg_upload_bytes());
+    tte_printf("#{P:%d,%d; cx:0x%X000}AFF%2d VQ%5u SE%4u", DEBUG_STATS_X, DEBUG_STATS_Y + 2 * TTE_CHAR_SIZE, TTE_WHITE_PB, sprite_get_num_affines_in_use(), vram_queue_get_num_pending_bytes(), se_commit_peak_bytes);
+    // Free sprite palette banks, and how many times since boot a bank was wanted with none free
+    tte_printf("#{P:%d,%d; cx:0x%X000}UPD%6uc PAL%2d EX%u", DEBUG_STATS_X, DEBUG_STATS_Y + 3 * TTE_CHAR_SIZE, TTE_WHITE_PB, update_cycles, pal_bank_get_num_free(PAL_BANK_OBJ), pal_bank_get_num_exhausted());
+    tte_printf("#{P:%d,%d; cx:0x%X000}TIER %d %3u%% OVR %u", DEBUG_STATS_X, DEBUG_STATS_Y + 4 * TTE_CHAR_SIZE, TTE_WHITE_PB, quality_get_tier(), quality_get_load_percent(), quality_get_num_overruns());
+    se_commit_peak_bytes = 0;
+}
+#endif
+
+static void vblank_isr()
+{
+    affine_background_vblank(); // Has to be done before the first scanline is drawn
+    mmVBlank();
+}
+
 void init()
 {
     irq_init(NULL);
-    irq_add(II_VBLANK, mmVBlank);
+    irq_add(II_VBLANK, vblank_isr);
+#ifdef AFFINE_BG_HBLANK_IRQ
     irq_add(II_HBLANK, affine_background_hblank);
+#endif
 
     // Initialize text engine
     tte_init_se(0, BG_CBB(TTE_CBB) | BG_SBB(TTE_SBB), 0, CLR_WHITE, TTE_BIT_UNPACK_OFFSET, NULL, NULL);
     tte_erase_screen();
     tte_init_con();
 
+    // After tte_init_se() so the shadow starts with the colors it set
+    pal_bank_init();
+    pal_fx_init();
+    // The 8bpp backgrounds use fixed colors from the first banks and the text has its own
+    for (int bank = 0; bank <= AFFINE_BG_PB / PAL_ROW_LEN; bank++)
+    {
+        pal_bank_reserve(PAL_BANK_BG, bank);
+    }
+    for (int bank = TTE_YELLOW_PB; bank <= TTE_WHITE_PB; bank++)
+    {
+        pal_bank_reserve(PAL_BANK_BG, bank);
+    }
+
     // TTE palette setup
-    pal_bg_bank[TTE_YELLOW_PB][TTE_BIT_ON_CLR_IDX] = TEXT_CLR_YELLOW;
-    pal_bg_bank[TTE_BLUE_PB][TTE_BIT_ON_CLR_IDX] = TEXT_CLR_BLUE; 
-    pal_bg_bank[TTE_RED_PB][TTE_BIT_ON_CLR_IDX] = TEXT_CLR_RED; 
-    pal_bg_bank[TTE_WHITE_PB][TTE_BIT_ON_CLR_IDX] = TEXT_CLR_WHITE;
+    pal_bg_shadow[TTE_YELLOW_PB * PAL_ROW_LEN + TTE_BIT_ON_CLR_IDX] = TEXT_CLR_YELLOW;
+    pal_bg_shadow[TTE_BLUE_PB * PAL_ROW_LEN + TTE_BIT_ON_CLR_IDX] = TEXT_CLR_BLUE;
+    pal_bg_shadow[TTE_RED_PB * PAL_ROW_LEN + TTE_BIT_ON_CLR_IDX] = TEXT_CLR_RED;
+    pal_bg_shadow[TTE_WHITE_PB * PAL_ROW_LEN + TTE_BIT_ON_CLR_IDX] = TEXT_CLR_WHITE;
 
     // Set up the video mode
     // BG0 is the TTE text layer
@@ -76,18 +130,39 @@ void init()
     blind_init();
     joker_init();
     game_init();
+#ifdef BENCHMARK
+    pal_fx_draw(); // The benchmark has its own loop
+    benchmark_run(); // Doesn't return
+#endif
+    quality_init();
     game_change_state(GAME_STATE_SPLASH_SCREEN);
+    pal_fx_fade(CLR_BLACK, PAL_FX_FADE_MAX, 0, BOOT_FADE_FRAMES);
 }
 
 void update()
 {
     affine_background_update();
     game_update();
+    joker_palettes_update();
+    pal_fx_update(); // After every palette change of the frame
+    sprite_build_oam(); // Once everything has moved so draw() only has to copy
 }
 
 void draw()
 {
+#ifdef DEBUG_STATS
+    profile_start();
     sprite_draw();
+    oam_upload_cycles = profile_stop();
+#else
+    sprite_draw();
+#endif
+    pal_fx_draw();
+    main_bg_se_commit();
+#ifdef DEBUG_STATS
+    se_commit_peak_bytes = max(se_commit_peak_bytes, main_bg_se_get_commit_bytes());
+#endif
+    vram_queue_process(); // Last, the OAM is more time critical
 }
 
 int main()
@@ -97,10 +172,22 @@ int main()
 	while(true)
     {
         VBlankIntrWait();
+        quality_frame_start();
+        // Upload what changed during the last update while still in VBlank
+        draw();
         mmFrame();
 		key_poll();
+#ifdef DEBUG_STATS
+        profile_start();
         update();
-        draw();
+        update_cycles = profile_stop();
+#else
+        update();
+#endif
+#ifdef DEBUG_STATS
+        draw_debug_stats();
+#endif
+        quality_frame_end();
     }
 
 	return 0;
@@ -0,0 +1,141 @@
+#include "pal_bank.h"
+#include "graphic_utils.h"
+#include "util.h"
+
+#include <string.h>
+
+#define PAL_BANK_RESERVED -1 // num_users of the banks outside the allocator
+
+typedef struct
+{
+    const COLOR *src; // NULL if nothing was loaded in the bank yet
+    u8 variant;
+    int num_users;
+    uint last_released;
+} PalBank;
+
+COLOR pal_shadow[PAL_BANK_NUM_TYPES][NUM_PALETTES * PAL_ROW_LEN] ALIGN4;
+
+static PalBank banks[PAL_BANK_NUM_TYPES][NUM_PALETTES];
+static uint release_clock = 0;
+static uint num_exhausted = 0;
+
+static bool pal_bank_matches(const PalBank *bank, const COLOR *src, u8 variant)
+{
+    return bank->src != NULL && bank->variant == variant
+        && (bank->src == src || memcmp(bank->src, src, PAL_ROW_LEN * sizeof(COLOR)) == 0);
+}
+
+// Banks that were never loaded go first, then the least recently released
+static bool pal_bank_is_better_victim(const PalBank *bank, const PalBank *victim)
+{
+    if (victim == NULL)
+        return true;
+    if (victim->src == NULL)
+        return false;
+
+    return bank->src == NULL || bank->last_released < victim->last_released;
+}
+
+void pal_bank_init(void)
+{
+    // Keeps the colors that were already set, such as the text ink set by TTE
+    memcpy32(pal_shadow, pal_mem, sizeof(pal_shadow) / sizeof(u32));
+
+    for (int type = 0; type < PAL_BANK_NUM_TYPES; type++)
+    {
+        for (int i = 0; i < NUM_PALETTES; i++)
+        {
+            banks[type][i] = (PalBank){ .src = NULL, .variant = PAL_BANK_VARIANT_PLAIN, .num_users = 0, .last_released = 0 };
+        }
+    }
+}
+
+void pal_bank_reserve(enum PalBankType type, int bank)
+{
+    banks[type][bank].num_users = PAL_BANK_RESERVED;
+}
+
+int pal_bank_acquire(enum PalBankType type, const COLOR *src, u8 variant, bool *is_new)
+{
+    PalBank *victim = NULL;
+
+    for (int i = 0; i < NUM_PALETTES; i++)
+    {
+        PalBank *bank = &banks[type][i];
+        if (bank->num_users == PAL_BANK_RESERVED)
+            continue;
+
+        if (pal_bank_matches(bank, src, variant))
+        {
+            bank->num_users++;
+            if (is_new != NULL) *is_new = false;
+            return i;
+        }
+
+        if (bank->num_users == 0 && pal_bank_is_better_victim(bank, victim))
+        {
+            victim = bank;
+        }
+    }
+
+    if (victim == NULL)
+    {
+        num_exhausted++;
+        return UNDEFINED;
+    }
+
+    int index = victim - banks[type];
+    victim->src = src;
+    victim->variant = variant;
+    victim->num_users = 1;
+
+    memcpy16(&pal_shadow[type][index * PAL_ROW_LEN], src, PAL_ROW_LEN);
+
+    if (is_new != NULL) *is_new = true;
+    return index;
+}
+
+void pal_bank_add_user(enum PalBankType type, int bank)
+{
+    if (banks[type][bank].num_users != PAL_BANK_RESERVED)
+    {
+        banks[type][bank].num_users++;
+    }
+}
+
+void pal_bank_release(enum PalBankType type, int bank)
+{
+    PalBank *pal_bank = &banks[type][bank];
+    if (pal_bank->num_users <= 0)
+        return;
+
+    if (--pal_bank->num_users == 0)
+    {
+        pal_bank->last_released = ++release_clock;
+    }
+}
+
+COLOR *pal_bank_edit(enum PalBankType type, int bank)
+{
+    return &pal_shadow[type][bank * PAL_ROW_LEN];
+}
+
+int pal_bank_get_num_free(enum PalBankType type)
+{
+    int num_free = 0;
+    for (int i = 0; i < NUM_PALETTES; i++)
+    {
+        if (banks[type][i].num_users == 0)
+        {
+            num_free++;
+        }
+    }
+
+    return num_free;
+}
+
+uint pal_bank_get_num_exhausted(void)
+{
+    return num_exhausted;
+}
@@ -0,0 +1,189 @@
+#include "pal_fx.h"
+#include "util.h"
+
+#define NUM_CHANNEL_LEVELS 32
+#define FADE_SHIFT 8 // Fraction bits of the fade amount so slow fades still move every frame
+
+typedef struct
+{
+    const u8 *indices; // NULL if the cycle isn't in use
+    int num_indices;
+    int period;
+    int frame;
+    enum PalBankType type;
+} PalCycle;
+
+static PalCycle cycles[PAL_FX_MAX_CYCLES];
+
+static COLOR fade_color = CLR_BLACK;
+static int fade_amount = 0; // In 1 << FADE_SHIFT units
+static int fade_target = 0;
+static int fade_step = 0;
+static int fade_table_amount = UNDEFINED; // The amount the tables were built for
+
+// The faded level of each channel level, already shifted into place
+static u16 fade_table_r[NUM_CHANNEL_LEVELS];
+static u16 fade_table_g[NUM_CHANNEL_LEVELS];
+static u16 fade_table_b[NUM_CHANNEL_LEVELS];
+
+EWRAM_BSS static COLOR faded_palette[PAL_BANK_NUM_TYPES][NUM_PALETTES * PAL_ROW_LEN] ALIGN4;
+
+void pal_fx_init(void)
+{
+    for (int i = 0; i < PAL_FX_MAX_CYCLES; i++)
+    {
+        cycles[i].indices = NULL;
+    }
+
+    fade_amount = 0;
+    fade_target = 0;
+    fade_step = 0;
+    fade_table_amount = UNDEFINED;
+}
+
+void pal_fx_fade(COLOR color, int from, int to, int frames)
+{
+    fade_color = color;
+    // tonc's clamp() excludes the upper bound
+    fade_amount = clamp(from, 0, PAL_FX_FADE_MAX + 1) << FADE_SHIFT;
+    fade_target = clamp(to, 0, PAL_FX_FADE_MAX + 1) << FADE_SHIFT;
+    fade_step = (fade_target - fade_amount) / max(frames, 1);
+    fade_table_amount = UNDEFINED; // The color may have changed
+
+    if (fade_step == 0)
+    {
+        fade_amount = fade_target;
+    }
+}
+
+bool pal_fx_is_fading(void)
+{
+    return fade_amount != fade_target;
+}
+
+int pal_fx_cycle_start(enum PalBankType type, const u8 *indices, int num_indices, int period)
+{
+    for (int i = 0; i < PAL_FX_MAX_CYCLES; i++)
+    {
+        if (cycles[i].indices == NULL)
+        {
+            cycles[i] = (PalCycle){ .indices = indices, .num_indices = num_indices, .period = max(period, 1), .frame = 0, .type = type };
+            return i;
+        }
+    }
+
+    return UNDEFINED;
+}
+
+void pal_fx_cycle_stop(int cycle)
+{
+    if (cycle >= 0 && cycle < PAL_FX_MAX_CYCLES)
+    {
+        cycles[cycle].indices = NULL;
+    }
+}
+
+static void pal_fx_cycle_step(const PalCycle *cycle)
+{
+    COLOR *colors = pal_shadow[cycle->type];
+    COLOR last = colors[cycle->indices[cycle->num_indices - 1]];
+
+    for (int i = cycle->num_indices - 1; i > 0; i--)
+    {
+        colors[cycle->indices[i]] = colors[cycle->indices[i - 1]];
+    }
+
+    colors[cycle->indices[0]] = last;
+}
+
+static void pal_fx_build_fade_tables(int amount)
+{
+    int target_r = fade_color & 0x1F;
+    int target_g = (fade_color >> 5) & 0x1F;
+    int target_b = (fade_color >> 10) & 0x1F;
+
+    for (int level = 0; level < NUM_CHANNEL_LEVELS; level++)
+    {
+        fade_table_r[level] = level + (((target_r - level) * amount) >> 5);
+        fade_table_g[level] = (level + (((target_g - level) * amount) >> 5)) << 5;
+        fade_table_b[level] = (level + (((target_b - level) * amount) >> 5)) << 10;
+    }
+
+    fade_table_amount = amount;
+}
+
+static inline COLOR pal_fx_fade_color(COLOR color)
+{
+    return fade_table_r[color & 0x1F] | fade_table_g[(color >> 5) & 0x1F] | fade_table_b[(color >> 10) & 0x1F];
+}
+
+// The fade tables for the amount showing, false if no fade is showing
+static bool pal_fx_prepare_fade(void)
+{
+    int amount = fade_amount >> FADE_SHIFT;
+    if (amount == 0)
+        return false;
+
+    if (amount != fade_table_amount)
+    {
+        pal_fx_build_fade_tables(amount);
+    }
+
+    return true;
+}
+
+void pal_fx_update(void)
+{
+    for (int i = 0; i < PAL_FX_MAX_CYCLES; i++)
+    {
+        PalCycle *cycle = &cycles[i];
+        if (cycle->indices != NULL && ++cycle->frame >= cycle->period)
+        {
+            cycle->frame = 0;
+            pal_fx_cycle_step(cycle);
+        }
+    }
+
+    if (fade_amount != fade_target)
+    {
+        fade_amount += fade_step;
+        if ((fade_step > 0 && fade_amount > fade_target) || (fade_step < 0 && fade_amount < fade_target))
+        {
+            fade_amount = fade_target;
+        }
+    }
+
+    if (!pal_fx_prepare_fade())
+        return;
+
+    // The shadow can change every frame so the fade is applied every frame it's showing
+    const COLOR *src = &pal_shadow[0][0];
+    COLOR *dst = &faded_palette[0][0];
+    for (int i = 0; i < PAL_BANK_NUM_TYPES * NUM_PALETTES * PAL_ROW_LEN; i++)
+    {
+        dst[i] = pal_fx_fade_color(src[i]);
+    }
+}
+
+void pal_fx_show_now(enum PalBankType type)
+{
+    const COLOR *src = pal_shadow[type];
+    COLOR *dst = &pal_mem[type * NUM_PALETTES * PAL_ROW_LEN];
+
+    if (!pal_fx_prepare_fade())
+    {
+        memcpy32(dst, src, NUM_PALETTES * PAL_ROW_LEN * sizeof(COLOR) / sizeof(u32));
+        return;
+    }
+
+    for (int i = 0; i < NUM_PALETTES * PAL_ROW_LEN; i++)
+    {
+        dst[i] = pal_fx_fade_color(src[i]);
+    }
+}
+
+void pal_fx_draw(void)
+{
+    const void *src = (fade_amount >> FADE_SHIFT) != 0 ? (const void *)faded_palette : (const void *)pal_shadow;
+    dma3_cpy(pal_mem, src, sizeof(pal_shadow));
+}
@@ -0,0 +1,98 @@
+#include "quality.h"
+
+#define QUALITY_TICK_CYCLES 64 // Timer 1 runs at TM_FREQ_64
+#define QUALITY_FRAME_CYCLES 280896 // 228 scanlines of 1232 cycles
+#define QUALITY_FRAME_TICKS (QUALITY_FRAME_CYCLES / QUALITY_TICK_CYCLES)
+
+// A frame above the high load step is close to missing VBlank
+#define QUALITY_HIGH_LOAD_TICKS (QUALITY_FRAME_TICKS * 7 / 8)
+#define QUALITY_LOW_LOAD_TICKS (QUALITY_FRAME_TICKS / 2)
+#define QUALITY_HIGH_LOAD_FRAMES 8 // In a row before stepping down a tier
+#define QUALITY_LOW_LOAD_FRAMES 180 // In a row before stepping back up a tier
+
+static enum QualityTier tier = QUALITY_TIER_FULL;
+static uint num_overruns = 0;
+static u16 frame_start_tick = 0;
+static u16 last_frame_ticks = 0;
+static int high_load_frames = 0;
+static int low_load_frames = 0;
+
+void quality_init(void)
+{
+    REG_TM1CNT = 0;
+    REG_TM1D = 0;
+    REG_TM1CNT = TM_ENABLE | TM_FREQ_64;
+
+    tier = QUALITY_TIER_FULL;
+    num_overruns = 0;
+    high_load_frames = 0;
+    low_load_frames = 0;
+}
+
+void quality_frame_start(void)
+{
+    frame_start_tick = REG_TM1D;
+}
+
+static void quality_step_down(void)
+{
+    if (tier < QUALITY_TIER_NUM - 1)
+    {
+        tier++;
+    }
+
+    high_load_frames = 0;
+    low_load_frames = 0;
+}
+
+void quality_frame_end(void)
+{
+    // The timer wraps every 15 frames so the 16 bit difference is enough
+    last_frame_ticks = (u16)(REG_TM1D - frame_start_tick);
+
+    if (last_frame_ticks >= QUALITY_FRAME_TICKS)
+    {
+        // The next VBlank has already passed, the frame was dropped
+        num_overruns++;
+        quality_step_down();
+        return;
+    }
+
+    if (last_frame_ticks >= QUALITY_HIGH_LOAD_TICKS)
+    {
+        low_load_frames = 0;
+        if (++high_load_frames >= QUALITY_HIGH_LOAD_FRAMES)
+        {
+            quality_step_down();
+        }
+    }
+    else if (last_frame_ticks < QUALITY_LOW_LOAD_TICKS)
+    {
+        high_load_frames = 0;
+        if (++low_load_frames >= QUALITY_LOW_LOAD_FRAMES && tier > QUALITY_TIER_FULL)
+        {
+            tier--;
+            low_load_frames = 0;
+        }
+    }
+    else
+    {
+        high_load_frames = 0;
+        low_load_frames = 0;
+    }
+}
+
+enum QualityTier quality_get_tier(void)
+{
+    return tier;
+}
+
+uint quality_get_num_overruns(void)
+{
+    return num_overruns;
+}
+
+uint quality_get_load_percent(void)
+{
+    return last_frame_ticks * 100 / QUALITY_FRAME_TICKS;
+}
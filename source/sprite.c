@@ -4,73 +4,238 @@
 #include "audio_utils.h"
 #include "soundbank.h"
 #include "pool.h"
+#include "quality.h"
+#include "vram_queue.h"
 
 #include <tonc.h>
 #include <stdlib.h>
+#include <string.h>
 #include <maxmod.h>
 
 #define MAX_SPRITES 128
 #define MAX_AFFINES 32
 #define SPRITE_FOCUS_RAISE_PX 10
 
+// lu_sin() only looks at the top 9 bits of an angle
+#define SPRITE_ROTATION_STEP_SHIFT 7
+#define SPRITE_ROTATION_STEPS 512
+#define SPRITE_AFFINE_CACHE_NUM_SCALES 2
+#define SPRITE_AFFINE_CACHE_TILT_STEPS 32 // About 22 degrees either way
+#define SPRITE_AFFINE_CACHE_TILTS (2 * SPRITE_AFFINE_CACHE_TILT_STEPS + 1)
+
+#define OAM_DIRTY_BITS_PER_WORD 32
+#define OBJ_ATTRS_PER_AFFINE (sizeof(OBJ_AFFINE) / sizeof(OBJ_ATTR))
+
 OBJ_ATTR obj_buffer[MAX_SPRITES];
 OBJ_AFFINE *obj_aff_buffer = (OBJ_AFFINE*)obj_buffer;
 
-static Sprite *free_sprites[MAX_SPRITES] = {NULL};
-static bool free_affines[MAX_AFFINES] = {false};
+// Every live sprite, kept sorted by layer when the OAM is built
+static Sprite *draw_list[MAX_SPRITES] = {NULL};
+static int draw_list_size = 0;
+static int num_oam_entries_used = 0; // Entries of obj_buffer written by the last build, the rest are hidden
+
+// The affine matrices are shared between the sprites with the same scale and rotation,
+// so all the cards and jokers at rest use a single identity matrix.
+// MAX_AFFINES fits in one word, a set bit is a matrix in use.
+// Rotations are kept in lu_sin() steps, angles within a step give the same matrix.
+static u32 used_affines = 0;
+static u8 affine_num_users[MAX_AFFINES] = {0};
+static FIXED affine_scale[MAX_AFFINES];
+static u16 affine_rotation_step[MAX_AFFINES];
+
+// Matrices for the scales cards rest at and the small tilts of movement and shakes,
+// computed once at boot into RAM. It's not a ROM table: a table generated offline
+// could round differently from libtonc's sine table and make matrices jump by a step
+// when a sprite crosses from a cached tilt to one computed by obj_aff_rotscale().
+// Row SPRITE_AFFINE_CACHE_TILT_STEPS of each scale is the untilted matrix.
+static const FIXED sprite_affine_cache_scales[SPRITE_AFFINE_CACHE_NUM_SCALES] =
+{
+    FIX_ONE,
+    FIX_ONE * 4 / 5, // The main menu ace
+};
+EWRAM_BSS static OBJ_AFFINE sprite_affine_cache[SPRITE_AFFINE_CACHE_NUM_SCALES][SPRITE_AFFINE_CACHE_TILTS];
+
+// One bit per entry of obj_buffer that changed since the last upload.
+// The affine matrices live in the fill fields of obj_buffer,
+// so a changed matrix marks the 4 entries it's spread over.
+static u32 oam_dirty[MAX_SPRITES / OAM_DIRTY_BITS_PER_WORD] = {0};
+static uint oam_upload_bytes = 0;
+
+static void sprite_mark_dirty(int sprite_index)
+{
+    oam_dirty[sprite_index / OAM_DIRTY_BITS_PER_WORD] |= 1 << (sprite_index % OAM_DIRTY_BITS_PER_WORD);
+}
 
-// Sprite methods
-Sprite *sprite_new(u16 a0, u16 a1, u32 tid, u32 pb, int sprite_index)
+static void affine_mark_dirty(int aff_index)
 {
-    Sprite* sprite = POOL_GET(Sprite);
+    int first_entry = aff_index * OBJ_ATTRS_PER_AFFINE;
+    for (int i = 0; i < OBJ_ATTRS_PER_AFFINE; i++)
+    {
+        sprite_mark_dirty(first_entry + i);
+    }
+}
 
-    sprite->obj = NULL;
-    sprite->aff = NULL;
+// Returns the matrix in use with this scale and rotation, or UNDEFINED
+static int affine_find(FIXED scale, u16 rotation_step)
+{
+    u32 used = used_affines;
+    while (used)
+    {
+        int aff_index = __builtin_ctz(used);
+        if (affine_scale[aff_index] == scale && affine_rotation_step[aff_index] == rotation_step)
+            return aff_index;
+        used &= used - 1;
+    }
+
+    return UNDEFINED;
+}
+
+// Returns a free matrix slot, or UNDEFINED if all of them are in use
+static int affine_alloc()
+{
+    u32 free = ~used_affines;
+    if (free == 0)
+        return UNDEFINED;
+
+    int aff_index = __builtin_ctz(free);
+    used_affines |= 1 << aff_index;
+    affine_num_users[aff_index] = 0;
+    return aff_index;
+}
+
+// Returns the cached matrix for this scale and rotation, or NULL if it isn't cached
+static const OBJ_AFFINE *sprite_affine_cache_get(FIXED scale, u16 rotation_step)
+{
+    // Wraps the tilts either side of 0 around to the rows of the cache
+    uint tilt = (rotation_step + SPRITE_AFFINE_CACHE_TILT_STEPS) & (SPRITE_ROTATION_STEPS - 1);
+    if (tilt >= SPRITE_AFFINE_CACHE_TILTS)
+        return NULL;
 
-    if(!free_sprites[sprite_index])
+    for (int i = 0; i < SPRITE_AFFINE_CACHE_NUM_SCALES; i++)
     {
-        free_sprites[sprite_index] = sprite;
+        if (sprite_affine_cache_scales[i] == scale)
+            return &sprite_affine_cache[i][tilt];
     }
-    else
+
+    return NULL;
+}
+
+static void affine_set(int aff_index, FIXED scale, u16 rotation_step)
+{
+    affine_scale[aff_index] = scale;
+    affine_rotation_step[aff_index] = rotation_step;
+
+    OBJ_AFFINE aff;
+    const OBJ_AFFINE *src = sprite_affine_cache_get(scale, rotation_step);
+    if (src == NULL)
     {
-        POOL_FREE(Sprite, sprite);
-        return NULL;
+        obj_aff_rotscale(&aff, scale, scale, rotation_step << SPRITE_ROTATION_STEP_SHIFT);
+        src = &aff;
     }
 
-    if (a0 & ATTR0_AFF)
+    // Only copy the matrix, the fill fields in between hold OBJ_ATTRs
+    OBJ_AFFINE *dst = &obj_aff_buffer[aff_index];
+    dst->pa = src->pa;
+    dst->pb = src->pb;
+    dst->pc = src->pc;
+    dst->pd = src->pd;
+    affine_mark_dirty(aff_index);
+}
+
+static int affine_acquire(FIXED scale, u16 rotation_step)
+{
+    int aff_index = affine_find(scale, rotation_step);
+    if (aff_index == UNDEFINED)
     {
-        int aff_index = MAX_AFFINES;
+        aff_index = affine_alloc();
+        if (aff_index == UNDEFINED)
+            return UNDEFINED;
+        affine_set(aff_index, scale, rotation_step);
+    }
+
+    affine_num_users[aff_index]++;
+    return aff_index;
+}
+
+static void affine_release(int aff_index)
+{
+    if (--affine_num_users[aff_index] == 0)
+    {
+        used_affines &= ~(1 << aff_index);
+    }
+}
+
+bool sprite_shows_rotscale(const Sprite *sprite, FIXED scale, u16 alpha)
+{
+    int aff_index = sprite->aff - obj_aff_buffer;
+    return affine_scale[aff_index] == scale && affine_rotation_step[aff_index] == alpha >> SPRITE_ROTATION_STEP_SHIFT;
+}
+
+void sprite_rotscale(Sprite *sprite, FIXED scale, u16 alpha)
+{
+    if (sprite_shows_rotscale(sprite, scale, alpha))
+        return;
+
+    u16 rotation_step = alpha >> SPRITE_ROTATION_STEP_SHIFT;
+    int aff_index = sprite->aff - obj_aff_buffer;
 
-        for(int i = 0; i < MAX_AFFINES; i++)
+    int new_aff_index = affine_find(scale, rotation_step);
+    if (new_aff_index == UNDEFINED)
+    {
+        // Nobody else uses the current matrix, rewrite it in place
+        if (affine_num_users[aff_index] == 1)
         {
-            if(!free_affines[i])
-            {
-                free_affines[i] = true;
-                aff_index = i;
-                break;
-            }
+            affine_set(aff_index, scale, rotation_step);
+            return;
         }
 
-        if (aff_index == MAX_AFFINES)
+        new_aff_index = affine_alloc();
+        if (new_aff_index == UNDEFINED)
+            return; // Out of matrices, keep the old transform until one frees up
+
+        affine_set(new_aff_index, scale, rotation_step);
+    }
+
+    affine_num_users[new_aff_index]++;
+    affine_release(aff_index);
+
+    sprite->aff = &obj_aff_buffer[new_aff_index];
+    sprite->obj.attr1 = (sprite->obj.attr1 & ~ATTR1_AFF_ID_MASK) | ATTR1_AFF_ID(new_aff_index);
+}
+
+// Sprite methods
+Sprite *sprite_new(u16 a0, u16 a1, u32 tid, u32 pb, int layer)
+{
+    if (draw_list_size >= MAX_SPRITES)
+        return NULL;
+
+    Sprite* sprite = POOL_GET(Sprite);
+    if (sprite == NULL)
+        return NULL;
+
+    sprite->aff = NULL;
+    sprite->pos.x = 0; // Matches the position in the attributes set below
+    sprite->pos.y = 0;
+    sprite->layer = layer;
+    sprite->upload_ticket = VRAM_QUEUE_NO_TICKET;
+
+    if (a0 & ATTR0_AFF)
+    {
+        int aff_index = affine_acquire(FIX_ONE, 0);
+        if (aff_index == UNDEFINED)
         {
             POOL_FREE(Sprite, sprite);
             return NULL;
         }
 
         a1 = a1 | ATTR1_AFF_ID(aff_index);
-
-        sprite->obj = &obj_buffer[sprite_index];
         sprite->aff = &obj_aff_buffer[aff_index];
-        obj_set_attr(sprite->obj, a0, a1, ATTR2_PALBANK(pb) | tid);
-        obj_aff_identity(&obj_aff_buffer[aff_index]);
-    }
-    else
-    {
-        sprite->obj = &obj_buffer[sprite_index];
-        obj_set_attr(sprite->obj, a0, a1, ATTR2_PALBANK(pb) | tid);
     }
 
-    sprite->idx = sprite_index;
+    obj_set_attr(&sprite->obj, a0, a1, ATTR2_PALBANK(pb) | tid);
+
+    // Sprites on the same layer keep the order they were created in
+    draw_list[draw_list_size++] = sprite;
 
     return sprite;
 }
@@ -79,14 +244,21 @@ void sprite_destroy(Sprite **sprite)
 {
     if (*sprite == NULL) return;
 
-    obj_hide((*sprite)->obj);
-
     if ((*sprite)->aff != NULL)
     {
-        free_affines[(*sprite)->aff - obj_aff_buffer] = false;
+        affine_release((*sprite)->aff - obj_aff_buffer);
     }
 
-    free_sprites[(*sprite)->idx] = NULL;
+    for (int i = 0; i < draw_list_size; i++)
+    {
+        if (draw_list[i] == *sprite)
+        {
+            // Shift instead of swapping with the last one so the list stays sorted
+            memmove(&draw_list[i], &draw_list[i + 1], (draw_list_size - i - 1) * sizeof(Sprite*));
+            draw_list_size--;
+            break;
+        }
+    }
 
     POOL_FREE(Sprite, *sprite);
 
@@ -95,20 +267,170 @@ void sprite_destroy(Sprite **sprite)
 
 int sprite_get_layer(Sprite *sprite)
 {
-    if (sprite == NULL || sprite->obj == NULL) return UNDEFINED;
-    return sprite->obj - obj_buffer;
+    if (sprite == NULL) return UNDEFINED;
+    return sprite->layer;
+}
+
+void sprite_set_layer(Sprite *sprite, int layer)
+{
+    if (sprite == NULL) return;
+    sprite->layer = layer;
+}
+
+void sprite_set_upload_ticket(Sprite *sprite, u32 ticket)
+{
+    sprite->upload_ticket = ticket;
+}
+
+// Whether any part of a sprite at (x, y) would be on screen.
+// Double size affine sprites are drawn in a box twice their size.
+static bool sprite_rect_is_on_screen(const Sprite *sprite, int x, int y)
+{
+    int width = obj_get_width(&sprite->obj);
+    int height = obj_get_height(&sprite->obj);
+
+    if ((sprite->obj.attr0 & ATTR0_MODE_MASK) == ATTR0_AFF_DBL)
+    {
+        width *= 2;
+        height *= 2;
+    }
+
+    return x < SCREEN_WIDTH && x + width > 0 && y < SCREEN_HEIGHT && y + height > 0;
+}
+
+bool sprite_is_on_screen(const Sprite *sprite)
+{
+    return sprite_rect_is_on_screen(sprite, sprite->pos.x, sprite->pos.y);
+}
+
+void sprite_hide(Sprite *sprite)
+{
+    obj_hide(&sprite->obj);
+}
+
+void sprite_unhide(Sprite *sprite, u16 mode)
+{
+    obj_unhide(&sprite->obj, mode);
 }
 
 // Sprite functions
 void sprite_init()
 {
     oam_init(obj_buffer, MAX_SPRITES); 
+
+    // Built from the same sine table as obj_aff_rotscale() so both give identical matrices
+    for (int i = 0; i < SPRITE_AFFINE_CACHE_NUM_SCALES; i++)
+    {
+        for (int tilt = 0; tilt < SPRITE_AFFINE_CACHE_TILTS; tilt++)
+        {
+            u16 rotation_step = (tilt - SPRITE_AFFINE_CACHE_TILT_STEPS) & (SPRITE_ROTATION_STEPS - 1);
+            obj_aff_rotscale(&sprite_affine_cache[i][tilt], sprite_affine_cache_scales[i], sprite_affine_cache_scales[i], rotation_step << SPRITE_ROTATION_STEP_SHIFT);
+        }
+    }
+
+    for (int i = 0; i < NUM_ELEM_IN_ARR(oam_dirty); i++)
+    {
+        oam_dirty[i] = ~0;
+    }
+}
+
+// Insertion sort, the list is already sorted unless layers changed since the last frame so this is a single pass
+static void sprite_sort_draw_list()
+{
+    for (int i = 1; i < draw_list_size; i++)
+    {
+        Sprite *sprite = draw_list[i];
+        int j = i - 1;
+
+        while (j >= 0 && draw_list[j]->layer > sprite->layer)
+        {
+            draw_list[j + 1] = draw_list[j];
+            j--;
+        }
+
+        draw_list[j + 1] = sprite;
+    }
 }
 
+// Lays the sprites out in obj_buffer by layer, lower layers take lower entries and are drawn on top.
+// Only the entries that changed are marked for upload.
+// Call once the frame's update is done so sprite_draw() only has to copy.
+void sprite_build_oam()
+{
+    sprite_sort_draw_list();
+
+    int num_entries = 0;
+    for (int i = 0; i < draw_list_size; i++)
+    {
+        const Sprite *sprite = draw_list[i];
+
+        // Hidden and culled sprites don't take an entry, neither do sprites whose tiles haven't landed
+        if ((sprite->obj.attr0 & ATTR0_MODE_MASK) == ATTR0_HIDE || !sprite_is_on_screen(sprite)
+            || !vram_queue_is_done(sprite->upload_ticket))
+            continue;
+
+        const OBJ_ATTR *src = &sprite->obj;
+        OBJ_ATTR *dst = &obj_buffer[num_entries];
+
+        // The fill field holds part of an affine matrix, leave it alone
+        if (dst->attr0 != src->attr0 || dst->attr1 != src->attr1 || dst->attr2 != src->attr2)
+        {
+            dst->attr0 = src->attr0;
+            dst->attr1 = src->attr1;
+            dst->attr2 = src->attr2;
+            sprite_mark_dirty(num_entries);
+        }
+
+        num_entries++;
+    }
+
+    for (int i = num_entries; i < num_oam_entries_used; i++)
+    {
+        obj_hide(&obj_buffer[i]);
+        sprite_mark_dirty(i);
+    }
+
+    num_oam_entries_used = num_entries;
+}
+
+// Uploads the changed runs of obj_buffer (and the affine matrices in it) with DMA3.
+// Call at the start of VBlank.
 void sprite_draw()
 {
-    obj_aff_copy(obj_aff_mem, obj_aff_buffer, MAX_AFFINES);
-    oam_copy(oam_mem, obj_buffer, MAX_SPRITES);
+    oam_upload_bytes = 0;
+
+    for (int word = 0; word < NUM_ELEM_IN_ARR(oam_dirty); word++)
+    {
+        u32 dirty = oam_dirty[word];
+        oam_dirty[word] = 0;
+
+        while (dirty)
+        {
+            int first = __builtin_ctz(dirty);
+            u32 remaining = ~(dirty >> first);
+            // All the bits from first up are set when remaining is 0, __builtin_ctz(0) is undefined
+            int count = remaining ? __builtin_ctz(remaining) : OAM_DIRTY_BITS_PER_WORD - first;
+
+            int sprite_index = word * OAM_DIRTY_BITS_PER_WORD + first;
+            uint num_bytes = count * sizeof(OBJ_ATTR);
+            dma_cpy(&oam_mem[sprite_index], &obj_buffer[sprite_index], num_bytes / sizeof(u32), 3, DMA_CPY32);
+            oam_upload_bytes += num_bytes;
+
+            if (first + count >= OAM_DIRTY_BITS_PER_WORD)
+                break;
+            dirty &= ~0u << (first + count);
+        }
+    }
+}
+
+uint sprite_get_oam_upload_bytes()
+{
+    return oam_upload_bytes;
+}
+
+int sprite_get_num_affines_in_use()
+{
+    return __builtin_popcount(used_affines);
 }
 
 int sprite_get_pb(const Sprite *sprite)
@@ -117,27 +439,24 @@ int sprite_get_pb(const Sprite *sprite)
     {
         return UNDEFINED;
     }
-    return (sprite->obj->attr2 & ATTR2_PALBANK_MASK) >> ATTR2_PALBANK_SHIFT;
+    return (sprite->obj.attr2 & ATTR2_PALBANK_MASK) >> ATTR2_PALBANK_SHIFT;
 }
 
 // SpriteObject methods
-SpriteObject* sprite_object_new()
+// Sprite objects live inside the card and joker objects, these set up and tear down one in place
+void sprite_object_init(SpriteObject* sprite_object)
 {
-    SpriteObject* sprite_object = POOL_GET(SpriteObject);
     sprite_object->sprite = NULL;
+    sprite_object->tweening = false;
     sprite_object_reset_transform(sprite_object);
     sprite_object->selected = false;
     sprite_object->focused = false;
-
-    return sprite_object;
 }
 
-void sprite_object_destroy(SpriteObject** sprite_object)
+void sprite_object_deinit(SpriteObject* sprite_object)
 {
-    if (*sprite_object == NULL) return;
-    sprite_destroy(&(*sprite_object)->sprite);
-    POOL_FREE(SpriteObject, *sprite_object);
-    *sprite_object = NULL;
+    tween_cancel_range(sprite_object, sizeof(SpriteObject));
+    sprite_destroy(&sprite_object->sprite);
 }
 
 void sprite_object_set_sprite(SpriteObject* sprite_object, Sprite* sprite)
@@ -150,6 +469,13 @@ void sprite_object_set_sprite(SpriteObject* sprite_object, Sprite* sprite)
 
 void sprite_object_reset_transform(SpriteObject* sprite_object)
 {
+    if (sprite_object->tweening)
+    {
+        tween_cancel_range(&sprite_object->tx, sizeof(sprite_object->tx) + sizeof(sprite_object->ty));
+    }
+    sprite_object->tweening = false;
+    sprite_object->on_tween_done = NULL;
+    sprite_object->tween_data = NULL;
     sprite_object->tx = 0; // Target position
     sprite_object->ty = 0;
     sprite_object->x = 0;
@@ -164,70 +490,54 @@ void sprite_object_reset_transform(SpriteObject* sprite_object)
     sprite_object->vrotation = 0;
 }
 
-void sprite_object_update(SpriteObject* sprite_object)
+void sprite_object_shake(SpriteObject* sprite_object, mm_word sound_id)
 {
-    sprite_object->vx += ((sprite_object->tx - sprite_object->x) * get_game_speed()) / 8;
-    sprite_object->vy += ((sprite_object->ty - sprite_object->y) * get_game_speed()) / 8;
-
-    sprite_object->vscale += (sprite_object->tscale - sprite_object->scale) / 8; // Scale up the card when it's played
-
-    sprite_object->vrotation += (sprite_object->trotation - sprite_object->rotation) / 8; // Rotate the card when it's played
-
-    // set velocity to 0 if it's close enough to the target
-    const FIXED epsilon = float2fx(0.01f);
-    if (sprite_object->vx < epsilon && sprite_object->vx > -epsilon && sprite_object->vy < epsilon && sprite_object->vy > -epsilon)
+    if (quality_get_tier() < QUALITY_TIER_NO_SHAKE)
     {
-        sprite_object->vx = 0;
-        sprite_object->vy = 0;
-
-        sprite_object->x = sprite_object->tx;
-        sprite_object->y = sprite_object->ty;
+        sprite_object->vscale = float2fx(0.3f);
+        sprite_object->vrotation = float2fx(8.0f); //Rotate the card when it's scored
     }
-    else
-    {
-        sprite_object->vx = (sprite_object->vx * 7) / 10;
-        sprite_object->vy = (sprite_object->vy * 7) / 10;
 
-        sprite_object->x += sprite_object->vx;
-        sprite_object->y += sprite_object->vy;
-    }
+    if (sound_id == UNDEFINED) return; // If no sound ID is provided, do nothing
 
-    // Set scale to 0 if it's close enough to the target
-    if (sprite_object->vscale < epsilon && sprite_object->vscale > -epsilon)
-    {
-        sprite_object->vscale = 0;
-        sprite_object->scale = sprite_object->tscale; // Set the scale to the target scale
-    }
-    else
-    {
-        sprite_object->vscale = (sprite_object->vscale * 7) / 10;
-        sprite_object->scale += sprite_object->vscale;
-    }
+    play_sfx(sound_id, MM_BASE_PITCH_RATE);
+}
 
-    // Set rotation to 0 if it's close enough to the target
-    if (sprite_object->vrotation < epsilon && sprite_object->vrotation > -epsilon)
-    {
-        sprite_object->vrotation = 0;
-        sprite_object->rotation = sprite_object->trotation; // Set the rotation to the target rotation
-    }
-    else
+static void sprite_object_on_tween_done(void *data)
+{
+    SpriteObject *sprite_object = data;
+    sprite_object->tweening = false;
+
+    if (sprite_object->on_tween_done != NULL)
     {
-        sprite_object->vrotation = (sprite_object->vrotation * 7) / 10;
-        sprite_object->rotation += sprite_object->vrotation;
+        sprite_object->on_tween_done(sprite_object->tween_data);
     }
-
-    obj_aff_rotscale(sprite_object->sprite->aff, sprite_object->scale, sprite_object->scale, -sprite_object->vx + sprite_object->rotation); // Apply rotation and scale to the sprite
-    sprite_position(sprite_object->sprite, fx2int(sprite_object->x), fx2int(sprite_object->y));
 }
 
-void sprite_object_shake(SpriteObject* sprite_object, mm_word sound_id)
+bool sprite_object_tween_to(SpriteObject* sprite_object, FIXED x, FIXED y, int frames, EaseType ease, TweenCallback on_complete, void *data)
 {
-    sprite_object->vscale = float2fx(0.3f);
-    sprite_object->vrotation = float2fx(8.0f); //Rotate the card when it's scored
+    // tx and ty are next to each other
+    tween_cancel_range(&sprite_object->tx, sizeof(sprite_object->tx) + sizeof(sprite_object->ty));
 
-    if (sound_id == UNDEFINED) return; // If no sound ID is provided, do nothing
+    // Start from where the object is, not where the spring was pulling it
+    sprite_object->tx = sprite_object->x;
+    sprite_object->ty = sprite_object->y;
 
-    play_sfx(sound_id, MM_BASE_PITCH_RATE);
+    int x_tween = tween_start(&sprite_object->tx, x, frames, ease, NULL, NULL);
+    int y_tween = tween_start(&sprite_object->ty, y, frames, ease, sprite_object_on_tween_done, sprite_object);
+    if (x_tween == UNDEFINED || y_tween == UNDEFINED)
+    {
+        tween_cancel(x_tween);
+        tween_cancel(y_tween);
+        sprite_object->tweening = false;
+        return false;
+    }
+
+    sprite_object->tweening = true;
+    sprite_object->on_tween_done = on_complete;
+    sprite_object->tween_data = data;
+
+    return true;
 }
 
 void sprite_object_set_selected(SpriteObject* sprite_object, bool selected)
@@ -263,6 +573,15 @@ void sprite_object_set_focus(SpriteObject* sprite_object, bool focus)
     sprite_object->ty = sprite_object->ty + int2fx((focus ? -1 : 1) * SPRITE_FOCUS_RAISE_PX);
 }
 
+bool sprite_object_has_left_screen(const SpriteObject* sprite_object)
+{
+    const Sprite *sprite = sprite_object->sprite;
+    if (sprite == NULL)
+        return true;
+
+    return !sprite_is_on_screen(sprite) && !sprite_rect_is_on_screen(sprite, fx2int(sprite_object->tx), fx2int(sprite_object->ty));
+}
+
 bool sprite_object_is_focused(SpriteObject* sprite_object)
 {
     return sprite_object->focused;
@@ -0,0 +1,216 @@
+// The per frame sprite object integrator. The .iwram.c suffix makes the build
+// compile this unit as ARM code and link its text into IWRAM.
+#include "sprite.h"
+#include "quality.h"
+
+#include <tonc.h>
+
+// 179/256 ~= 0.6992, the velocity damping each frame without a division
+#define SPRITE_DAMPING_MUL 179
+#define SPRITE_DAMPING_SHIFT 8
+
+// The spring pulls 1/8th of the distance to the target per frame at game speed 1
+#define SPRITE_SPRING_SHIFT 3
+
+static int spring_shift = SPRITE_SPRING_SHIFT;
+
+// Game speeds are rounded down to a power of two so the spring stays a shift
+void sprite_object_set_game_speed(int game_speed)
+{
+    int shift = SPRITE_SPRING_SHIFT;
+    while (shift > 0 && game_speed >= 2)
+    {
+        game_speed >>= 1;
+        shift--;
+    }
+
+    spring_shift = shift;
+}
+
+// Shifts rounded towards zero, the same as dividing by 1 << shift
+static inline FIXED sprite_object_shift_down(FIXED value, int shift)
+{
+    if (value >= 0)
+        return value >> shift;
+    return -(-value >> shift);
+}
+
+// An object at rest whose sprite already shows its transform has nothing to integrate.
+// Any write to a target, position or velocity wakes it up again.
+static inline bool sprite_object_is_asleep(const SpriteObject* sprite_object)
+{
+    const Sprite *sprite = sprite_object->sprite;
+
+    if (sprite_object->vx != 0 || sprite_object->vy != 0 || sprite_object->vscale != 0 || sprite_object->vrotation != 0)
+        return false;
+
+    if (sprite_object->x != sprite_object->tx || sprite_object->y != sprite_object->ty
+        || sprite_object->scale != sprite_object->tscale || sprite_object->rotation != sprite_object->trotation)
+        return false;
+
+    if (sprite->pos.x != fx2int(sprite_object->x) || sprite->pos.y != fx2int(sprite_object->y))
+        return false;
+
+    // The matrix of a culled sprite is left as it is until it comes back on screen
+    if (sprite->aff == NULL || !sprite_is_on_screen(sprite))
+        return true;
+
+    return sprite_shows_rotscale(sprite, sprite_object->scale, sprite_object->rotation);
+}
+
+// Velocity * 179/256 rounded towards zero so small velocities still die out.
+// 179/256 is just under the old / 10 * 7 so this damps about 0.1% harder, it isn't bit identical.
+static inline FIXED sprite_object_damp(FIXED velocity)
+{
+    return sprite_object_shift_down(velocity * SPRITE_DAMPING_MUL, SPRITE_DAMPING_SHIFT);
+}
+
+// The awake objects of a batch are copied into one array per component so
+// each pass of the integrator is a flat loop over a single kind of value.
+#define SPRITE_OBJECT_BATCH_SIZE 32
+
+static SpriteObject *batch_objects[SPRITE_OBJECT_BATCH_SIZE];
+static FIXED batch_x[SPRITE_OBJECT_BATCH_SIZE], batch_y[SPRITE_OBJECT_BATCH_SIZE];
+static FIXED batch_vx[SPRITE_OBJECT_BATCH_SIZE], batch_vy[SPRITE_OBJECT_BATCH_SIZE];
+static FIXED batch_tx[SPRITE_OBJECT_BATCH_SIZE], batch_ty[SPRITE_OBJECT_BATCH_SIZE];
+static FIXED batch_scale[SPRITE_OBJECT_BATCH_SIZE], batch_vscale[SPRITE_OBJECT_BATCH_SIZE], batch_tscale[SPRITE_OBJECT_BATCH_SIZE];
+static FIXED batch_rotation[SPRITE_OBJECT_BATCH_SIZE], batch_vrotation[SPRITE_OBJECT_BATCH_SIZE], batch_trotation[SPRITE_OBJECT_BATCH_SIZE];
+
+// Settles a velocity that is close enough to zero onto the target, damps and applies it otherwise
+static inline void sprite_object_integrate(FIXED *values, FIXED *velocities, const FIXED *targets, int count)
+{
+    const FIXED epsilon = float2fx(0.01f);
+
+    for (int i = 0; i < count; i++)
+    {
+        if (velocities[i] < epsilon && velocities[i] > -epsilon)
+        {
+            velocities[i] = 0;
+            values[i] = targets[i];
+        }
+        else
+        {
+            velocities[i] = sprite_object_damp(velocities[i]);
+            values[i] += velocities[i];
+        }
+    }
+}
+
+static void sprite_object_update_awake(int count)
+{
+    const FIXED epsilon = float2fx(0.01f);
+
+    for (int i = 0; i < count; i++)
+    {
+        batch_vx[i] += sprite_object_shift_down(batch_tx[i] - batch_x[i], spring_shift);
+        batch_vy[i] += sprite_object_shift_down(batch_ty[i] - batch_y[i], spring_shift);
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        batch_vscale[i] += (batch_tscale[i] - batch_scale[i]) / 8; // Scale up the card when it's played
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        batch_vrotation[i] += (batch_trotation[i] - batch_rotation[i]) / 8; // Rotate the card when it's played
+    }
+
+    // The position settles only once both of its velocities are close enough to zero
+    for (int i = 0; i < count; i++)
+    {
+        if (batch_vx[i] < epsilon && batch_vx[i] > -epsilon && batch_vy[i] < epsilon && batch_vy[i] > -epsilon)
+        {
+            batch_vx[i] = 0;
+            batch_vy[i] = 0;
+
+            batch_x[i] = batch_tx[i];
+            batch_y[i] = batch_ty[i];
+        }
+        else
+        {
+            batch_vx[i] = sprite_object_damp(batch_vx[i]);
+            batch_vy[i] = sprite_object_damp(batch_vy[i]);
+
+            batch_x[i] += batch_vx[i];
+            batch_y[i] += batch_vy[i];
+        }
+    }
+
+    sprite_object_integrate(batch_scale, batch_vscale, batch_tscale, count);
+    sprite_object_integrate(batch_rotation, batch_vrotation, batch_trotation, count);
+
+    bool tilt = quality_get_tier() < QUALITY_TIER_NO_TILT;
+
+    for (int i = 0; i < count; i++)
+    {
+        SpriteObject *sprite_object = batch_objects[i];
+
+        sprite_object->x = batch_x[i];
+        sprite_object->y = batch_y[i];
+        sprite_object->vx = batch_vx[i];
+        sprite_object->vy = batch_vy[i];
+        sprite_object->scale = batch_scale[i];
+        sprite_object->vscale = batch_vscale[i];
+        sprite_object->rotation = batch_rotation[i];
+        sprite_object->vrotation = batch_vrotation[i];
+
+        sprite_position(sprite_object->sprite, fx2int(batch_x[i]), fx2int(batch_y[i]));
+        if (sprite_object->sprite->aff != NULL && sprite_is_on_screen(sprite_object->sprite))
+        {
+            // Without the tilt moving sprites keep sharing the matrix they rest with
+            sprite_rotscale(sprite_object->sprite, batch_scale[i], (tilt ? -batch_vx[i] : 0) + batch_rotation[i]); // Apply rotation and scale to the sprite
+        }
+    }
+}
+
+IWRAM_CODE void sprite_object_update_batch(SpriteObject **sprite_objects, int count)
+{
+    int num_awake = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        SpriteObject *sprite_object = sprite_objects[i];
+
+        if (sprite_object->tweening)
+        {
+            sprite_object->x = sprite_object->tx;
+            sprite_object->y = sprite_object->ty;
+            sprite_object->vx = 0;
+            sprite_object->vy = 0;
+        }
+
+        if (sprite_object_is_asleep(sprite_object))
+            continue;
+
+        batch_objects[num_awake] = sprite_object;
+        batch_x[num_awake] = sprite_object->x;
+        batch_y[num_awake] = sprite_object->y;
+        batch_vx[num_awake] = sprite_object->vx;
+        batch_vy[num_awake] = sprite_object->vy;
+        batch_tx[num_awake] = sprite_object->tx;
+        batch_ty[num_awake] = sprite_object->ty;
+        batch_scale[num_awake] = sprite_object->scale;
+        batch_vscale[num_awake] = sprite_object->vscale;
+        batch_tscale[num_awake] = sprite_object->tscale;
+        batch_rotation[num_awake] = sprite_object->rotation;
+        batch_vrotation[num_awake] = sprite_object->vrotation;
+        batch_trotation[num_awake] = sprite_object->trotation;
+
+        if (++num_awake == SPRITE_OBJECT_BATCH_SIZE)
+        {
+            sprite_object_update_awake(num_awake);
+            num_awake = 0;
+        }
+    }
+
+    if (num_awake > 0)
+    {
+        sprite_object_update_awake(num_awake);
+    }
+}
+
+IWRAM_CODE void sprite_object_update(SpriteObject* sprite_object)
+{
+    sprite_object_update_batch(&sprite_object, 1);
+}
@@ -0,0 +1,247 @@
+#include "tween.h"
+#include "util.h"
+
+#include <tonc.h>
+
+#define TWEEN_PHASE_SHIFT 16 // The phase is the position in the easing table in 16.16
+#define TWEEN_PHASE_END (EASE_LUT_STEPS << TWEEN_PHASE_SHIFT)
+#define EASE_ONE 256
+
+typedef struct
+{
+    FIXED *value;
+    const TweenKey *keys;
+    TweenKey key; // The storage for single key tracks
+    u8 num_keys;
+    u8 key_index;
+    FIXED from;
+    u32 phase;
+    u32 phase_step;
+    TweenCallback on_complete;
+    void *data;
+} Tween;
+
+// Easing curves sampled at EASE_LUT_STEPS + 1 points, 0 is the start value and 256 the end value.
+static const s16 ease_lut[EASE_NUM][EASE_LUT_STEPS + 1] =
+{
+    [EASE_LINEAR] =
+    {
+        0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60,
+        64, 68, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116, 120, 124,
+        128, 132, 136, 140, 144, 148, 152, 156, 160, 164, 168, 172, 176, 180, 184, 188,
+        192, 196, 200, 204, 208, 212, 216, 220, 224, 228, 232, 236, 240, 244, 248, 252,
+        256,
+    },
+    [EASE_IN_QUAD] =
+    {
+        0, 0, 0, 1, 1, 2, 2, 3, 4, 5, 6, 8, 9, 11, 12, 14,
+        16, 18, 20, 23, 25, 28, 30, 33, 36, 39, 42, 46, 49, 53, 56, 60,
+        64, 68, 72, 77, 81, 86, 90, 95, 100, 105, 110, 116, 121, 127, 132, 138,
+        144, 150, 156, 163, 169, 176, 182, 189, 196, 203, 210, 218, 225, 233, 240, 248,
+        256,
+    },
+    [EASE_OUT_QUAD] =
+    {
+        0, 8, 16, 23, 31, 38, 46, 53, 60, 67, 74, 80, 87, 93, 100, 106,
+        112, 118, 124, 129, 135, 140, 146, 151, 156, 161, 166, 170, 175, 179, 184, 188,
+        192, 196, 200, 203, 207, 210, 214, 217, 220, 223, 226, 228, 231, 233, 236, 238,
+        240, 242, 244, 245, 247, 248, 250, 251, 252, 253, 254, 254, 255, 255, 256, 256,
+        256,
+    },
+    [EASE_IN_OUT_QUAD] =
+    {
+        0, 0, 0, 1, 2, 3, 4, 6, 8, 10, 12, 15, 18, 21, 24, 28,
+        32, 36, 40, 45, 50, 55, 60, 66, 72, 78, 84, 91, 98, 105, 112, 120,
+        128, 136, 144, 151, 158, 165, 172, 178, 184, 190, 196, 201, 206, 211, 216, 220,
+        224, 228, 232, 235, 238, 241, 244, 246, 248, 250, 252, 253, 254, 255, 256, 256,
+        256,
+    },
+    [EASE_OUT_BACK] =
+    {
+        0, 18, 36, 53, 69, 84, 99, 113, 126, 139, 151, 162, 173, 183, 192, 201,
+        209, 217, 224, 231, 237, 243, 248, 253, 257, 261, 265, 268, 271, 273, 275, 277,
+        278, 280, 280, 281, 281, 282, 282, 281, 281, 280, 279, 278, 277, 276, 275, 274,
+        272, 271, 270, 268, 267, 265, 264, 263, 261, 260, 259, 258, 258, 257, 256, 256,
+        256,
+    },
+};
+
+static Tween tweens[MAX_TWEENS];
+// A set bit is a tween in use, only those are stepped
+static u32 active_tweens = 0;
+// Tweens that finished this frame and still have to call back
+static u32 pending_callbacks = 0;
+
+static void tween_start_key(Tween *tween)
+{
+    const TweenKey *key = &tween->keys[tween->key_index];
+
+    tween->from = *tween->value;
+    tween->phase = 0;
+    // The only division, once per key instead of every frame.
+    // Rounded up so the key ends on its last frame instead of one frame late.
+    int frames = max(key->frames, 1);
+    tween->phase_step = (TWEEN_PHASE_END + frames - 1) / frames;
+}
+
+// Returns a free tween index, or UNDEFINED if all of them are in use.
+// Finished tweens waiting to call back aren't free yet.
+static int tween_alloc(void)
+{
+    u32 free = ~(active_tweens | pending_callbacks);
+    if (free == 0)
+        return UNDEFINED;
+
+    int tween_index = __builtin_ctz(free);
+    active_tweens |= 1 << tween_index;
+    return tween_index;
+}
+
+static void tween_init(Tween *tween, FIXED *value, const TweenKey *keys, int num_keys, TweenCallback on_complete, void *data)
+{
+    tween->value = value;
+    tween->keys = keys;
+    tween->num_keys = num_keys;
+    tween->key_index = 0;
+    tween->on_complete = on_complete;
+    tween->data = data;
+    tween_start_key(tween);
+}
+
+int tween_start_track(FIXED *value, const TweenKey *keys, int num_keys, TweenCallback on_complete, void *data)
+{
+    if (value == NULL || keys == NULL || num_keys <= 0)
+        return UNDEFINED;
+
+    int tween_index = tween_alloc();
+    if (tween_index == UNDEFINED)
+        return UNDEFINED;
+
+    tween_init(&tweens[tween_index], value, keys, num_keys, on_complete, data);
+    return tween_index;
+}
+
+int tween_start(FIXED *value, FIXED to, int frames, EaseType ease, TweenCallback on_complete, void *data)
+{
+    if (value == NULL)
+        return UNDEFINED;
+
+    int tween_index = tween_alloc();
+    if (tween_index == UNDEFINED)
+        return UNDEFINED;
+
+    Tween *tween = &tweens[tween_index];
+    tween->key = (TweenKey){ to, frames, ease };
+    tween_init(tween, value, &tween->key, 1, on_complete, data);
+    return tween_index;
+}
+
+void tween_cancel(int tween_index)
+{
+    if (tween_index < 0 || tween_index >= MAX_TWEENS)
+        return;
+
+    active_tweens &= ~(1 << tween_index);
+    pending_callbacks &= ~(1 << tween_index);
+}
+
+void tween_cancel_range(const void *start, uint size)
+{
+    const u8 *begin = start;
+    const u8 *end = begin + size;
+
+    u32 active = active_tweens;
+    while (active)
+    {
+        int tween_index = __builtin_ctz(active);
+        active &= active - 1;
+
+        const u8 *value = (const u8 *)tweens[tween_index].value;
+        if (value >= begin && value < end)
+        {
+            tween_cancel(tween_index);
+        }
+    }
+
+    // Tweens that already finished this frame don't animate anything anymore but may still call back
+    u32 pending = pending_callbacks;
+    while (pending)
+    {
+        int tween_index = __builtin_ctz(pending);
+        pending &= pending - 1;
+
+        const u8 *value = (const u8 *)tweens[tween_index].value;
+        if (value >= begin && value < end)
+        {
+            pending_callbacks &= ~(1 << tween_index);
+        }
+    }
+}
+
+bool tween_is_active(int tween_index)
+{
+    if (tween_index < 0 || tween_index >= MAX_TWEENS)
+        return false;
+    return (active_tweens >> tween_index) & 1;
+}
+
+int tween_get_num_active(void)
+{
+    return __builtin_popcount(active_tweens);
+}
+
+// Returns true once the last key is reached
+static bool tween_step(Tween *tween)
+{
+    const TweenKey *key = &tween->keys[tween->key_index];
+
+    tween->phase += tween->phase_step;
+    if (tween->phase >= TWEEN_PHASE_END)
+    {
+        *tween->value = key->value;
+
+        if (++tween->key_index >= tween->num_keys)
+            return true;
+
+        tween_start_key(tween);
+        return false;
+    }
+
+    // Linear interpolation between the two nearest samples of the curve
+    const s16 *lut = ease_lut[key->ease];
+    int i = tween->phase >> TWEEN_PHASE_SHIFT;
+    int frac = (tween->phase >> (TWEEN_PHASE_SHIFT - 8)) & 0xFF;
+    int ease = lut[i] + (((lut[i + 1] - lut[i]) * frac) >> 8);
+
+    *tween->value = tween->from + ((key->value - tween->from) * ease) / EASE_ONE;
+    return false;
+}
+
+void tween_update(void)
+{
+    u32 active = active_tweens;
+    while (active)
+    {
+        int tween_index = __builtin_ctz(active);
+        active &= active - 1;
+
+        if (tween_step(&tweens[tween_index]))
+        {
+            active_tweens &= ~(1 << tween_index);
+            pending_callbacks |= 1 << tween_index;
+        }
+    }
+
+    // A callback can start or cancel tweens, so pick the next one from the bitmap each time
+    while (pending_callbacks)
+    {
+        int tween_index = __builtin_ctz(pending_callbacks);
+        pending_callbacks &= ~(1 << tween_index);
+
+        Tween *tween = &tweens[tween_index];
+        if (tween->on_complete != NULL)
+        {
+            tween->on_complete(tween->data);
+        }
+    }
+}
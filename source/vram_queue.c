@@ -0,0 +1,72 @@
+#include "vram_queue.h"
+
+typedef struct
+{
+    void *dst;
+    const void *src;
+    uint num_words;
+} VramJob;
+
+// Tickets are handed out in order and jobs complete in order, so a ticket
+// is done once it's at most num_done. The pending jobs are the tickets in
+// (num_done, num_pushed], job t is stored at jobs[t % VRAM_QUEUE_SIZE].
+static VramJob jobs[VRAM_QUEUE_SIZE];
+static u32 num_pushed = 0;
+static u32 num_done = 0;
+
+// Copies up to max_words of the oldest job, returns how many were copied
+static uint vram_queue_copy_oldest(uint max_words)
+{
+    VramJob *job = &jobs[(num_done + 1) % VRAM_QUEUE_SIZE];
+    uint num_words = job->num_words < max_words ? job->num_words : max_words;
+
+    dma_cpy(job->dst, job->src, num_words, 3, DMA_CPY32);
+
+    job->dst = (u32*)job->dst + num_words;
+    job->src = (const u32*)job->src + num_words;
+    job->num_words -= num_words;
+    if (job->num_words == 0)
+    {
+        num_done++;
+    }
+
+    return num_words;
+}
+
+u32 vram_queue_push(void *dst, const void *src, uint num_bytes)
+{
+    if (num_pushed - num_done == VRAM_QUEUE_SIZE)
+    {
+        vram_queue_copy_oldest(~0u); // All of it, outside VBlank like before the queue existed
+    }
+
+    num_pushed++;
+    jobs[num_pushed % VRAM_QUEUE_SIZE] = (VramJob){ dst, src, num_bytes / sizeof(u32) };
+
+    return num_pushed;
+}
+
+bool vram_queue_is_done(u32 ticket)
+{
+    return ticket <= num_done;
+}
+
+void vram_queue_process(void)
+{
+    uint budget = VRAM_QUEUE_FRAME_BUDGET / sizeof(u32);
+    while (num_done != num_pushed && budget > 0)
+    {
+        budget -= vram_queue_copy_oldest(budget);
+    }
+}
+
+uint vram_queue_get_num_pending_bytes(void)
+{
+    uint num_words = 0;
+    for (u32 ticket = num_done + 1; ticket <= num_pushed; ticket++)
+    {
+        num_words += jobs[ticket % VRAM_QUEUE_SIZE].num_words;
+    }
+
+    return num_words * sizeof(u32);
+}
@@ -0,0 +1,180 @@
+// Checks that the rows affine_background_prep_bgaff_arr() builds from the
+// rotation table are the same as calling bg_rotscale_ex() for every row,
+// which is how the main menu background rows used to be built.
+// The tonc parts are copied here so this runs on the host, keep them and
+// the row math in step with libtonc and source/affine_background.c.
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+typedef int16_t s16;
+typedef int32_t s32;
+typedef uint16_t u16;
+typedef unsigned int uint;
+
+typedef struct
+{
+    s16 pa, pb, pc, pd;
+    s32 dx, dy;
+} BG_AFFINE;
+
+typedef struct
+{
+    s32 tex_x, tex_y;
+    s16 scr_x, scr_y;
+    s16 sx, sy;
+    u16 alpha;
+} AFF_SRC_EX;
+
+#define SCREEN_WIDTH 240
+#define SCREEN_HEIGHT 160
+#define SIN_LUT_SIZE 512
+
+#define ANIMATION_SPEED_DIVISOR 16
+#define MAIN_MENU_TEX_POS (1000 * 1000)
+#define MAIN_MENU_SCALE 128
+#define BG_ROTATION_STEP_SHIFT 7
+#define BG_ROTATION_STEPS 512
+
+#define NUM_FRAMES_TO_TEST 5000
+
+// The identity being tested holds for any sine values, a 4.12 table like libtonc's is used anyway
+static s16 sin_lut[SIN_LUT_SIZE];
+
+static s32 lu_sin(uint theta)
+{
+    return sin_lut[(theta >> 7) & 0x1FF];
+}
+
+static s32 lu_cos(uint theta)
+{
+    return sin_lut[((theta >> 7) + 128) & 0x1FF];
+}
+
+// libtonc's bg_rotscale_ex()
+static void bg_rotscale_ex(BG_AFFINE *bgaff, const AFF_SRC_EX *asx)
+{
+    int sx = asx->sx, sy = asx->sy;
+    int sina = lu_sin(asx->alpha), cosa = lu_cos(asx->alpha);
+
+    s32 pa = sx * cosa >> 12;
+    s32 pb = -sx * sina >> 12;
+    s32 pc = sy * sina >> 12;
+    s32 pd = sy * cosa >> 12;
+
+    bgaff->pa = pa;
+    bgaff->pb = pb;
+    bgaff->pc = pc;
+    bgaff->pd = pd;
+
+    bgaff->dx = asx->tex_x - (pa * asx->scr_x + pb * asx->scr_y);
+    bgaff->dy = asx->tex_y - (pc * asx->scr_x + pd * asx->scr_y);
+}
+
+static BG_AFFINE bg_rotation_lut[BG_ROTATION_STEPS];
+
+// affine_background_init_rotation_lut()
+static void init_rotation_lut(void)
+{
+    AFF_SRC_EX rotation_src =
+    {
+        .tex_x = MAIN_MENU_TEX_POS,
+        .tex_y = MAIN_MENU_TEX_POS,
+        .scr_x = SCREEN_WIDTH / 2,
+        .scr_y = -(SCREEN_HEIGHT / 2),
+        .sx = MAIN_MENU_SCALE,
+        .sy = MAIN_MENU_SCALE,
+    };
+
+    for (int i = 0; i < BG_ROTATION_STEPS; i++)
+    {
+        rotation_src.alpha = i << BG_ROTATION_STEP_SHIFT;
+        bg_rotscale_ex(&bg_rotation_lut[i], &rotation_src);
+    }
+}
+
+// A row of affine_background_prep_bgaff_arr()
+static BG_AFFINE table_row(s32 phase, int vcount)
+{
+    const s32 vcount_sine = lu_sin((vcount << 8) + phase);
+    const u16 alpha = vcount_sine + phase;
+    const BG_AFFINE *rotation = &bg_rotation_lut[alpha >> BG_ROTATION_STEP_SHIFT];
+
+    BG_AFFINE row = *rotation;
+    row.dx += vcount_sine - rotation->pb * vcount;
+    row.dy -= rotation->pd * vcount;
+    return row;
+}
+
+// The row as it was built before the rotation table
+static BG_AFFINE rotscale_row(s32 phase, int vcount)
+{
+    const s32 vcount_sine = lu_sin((vcount << 8) + phase);
+
+    AFF_SRC_EX src =
+    {
+        .tex_x = MAIN_MENU_TEX_POS + vcount_sine,
+        .tex_y = MAIN_MENU_TEX_POS,
+        .scr_x = SCREEN_WIDTH / 2,
+        .scr_y = vcount - SCREEN_HEIGHT / 2,
+        .sx = MAIN_MENU_SCALE,
+        .sy = MAIN_MENU_SCALE,
+        .alpha = vcount_sine + phase,
+    };
+
+    BG_AFFINE row;
+    bg_rotscale_ex(&row, &src);
+    return row;
+}
+
+static bool rows_equal(const BG_AFFINE *a, const BG_AFFINE *b)
+{
+    return a->pa == b->pa && a->pb == b->pb && a->pc == b->pc && a->pd == b->pd
+        && a->dx == b->dx && a->dy == b->dy;
+}
+
+bool test_rows_match_rotscale(void)
+{
+    for (uint timer = 0; timer < NUM_FRAMES_TO_TEST; timer++)
+    {
+        const s32 phase = (s32)(timer << 8) / ANIMATION_SPEED_DIVISOR;
+
+        for (int vcount = 0; vcount < SCREEN_HEIGHT; vcount++)
+        {
+            BG_AFFINE expected = rotscale_row(phase, vcount);
+            BG_AFFINE actual = table_row(phase, vcount);
+            if (!rows_equal(&expected, &actual))
+            {
+                fprintf(stderr, "Error: row %d of frame %u differs from bg_rotscale_ex()\n"
+                                "    expected: %d %d %d %d %d %d, actual %d %d %d %d %d %d\n",
+                        vcount, timer,
+                        expected.pa, expected.pb, expected.pc, expected.pd, expected.dx, expected.dy,
+                        actual.pa, actual.pb, actual.pc, actual.pd, actual.dx, actual.dy);
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+int main(void)
+{
+    for (int i = 0; i < SIN_LUT_SIZE; i++)
+    {
+        sin_lut[i] = (s16)lround(4096 * sin(i * 2 * M_PI / SIN_LUT_SIZE));
+    }
+
+    init_rotation_lut();
+
+    printf("Testing Rotation Table Rows Against bg_rotscale_ex() for %d frames.\n", NUM_FRAMES_TO_TEST);
+    if (!test_rows_match_rotscale()) return 1;
+
+    printf("---------------------------------------------------------\n");
+    printf("Affine Background Tests Passed\n");
+    printf("---------------------------------------------------------\n");
+
+    return 0;
+}
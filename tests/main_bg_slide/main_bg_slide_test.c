@@ -0,0 +1,121 @@
+// Checks that main_bg_se_slide_up_step() and main_bg_se_slide_up_finish() leave
+// the main background the same as the single tile copies and moves they replace.
+// After every step the rows on screen have to match, after the finish all of them.
+// graphic_utils.c is included directly so the test can reach the shadow map,
+// tonc/ has the few libtonc parts it needs to build on the host.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../../source/graphic_utils.c"
+
+#define MAX_STEPS_TO_TEST 24
+
+SCREENBLOCK host_se_mem[32];
+u32 host_reg_dispcnt;
+u16 host_reg_bldcnt;
+
+void memcpy16(void *dst, const void *src, uint hwcount)
+{
+    memmove(dst, src, hwcount * sizeof(u16));
+}
+
+void memset16(void *dst, u16 hw, uint hwcount)
+{
+    for (uint i = 0; i < hwcount; i++)
+    {
+        ((u16 *)dst)[i] = hw;
+    }
+}
+
+void memcpy32(void *dst, const void *src, uint wcount)
+{
+    memmove(dst, src, wcount * sizeof(u32));
+}
+
+void memset32(void *dst, u32 wd, uint wcount)
+{
+    for (uint i = 0; i < wcount; i++)
+    {
+        ((u32 *)dst)[i] = wd;
+    }
+}
+
+void tte_erase_rect(int left, int top, int right, int bottom)
+{
+}
+
+// Rects going below the screen like the pop-up panels, and ones that stay on it
+static const Rect test_rects[] =
+{
+    {9, 7, 24, 31},
+    {11, 8, 23, 26},
+    {0, 18, 5, 31},
+    {2, 22, 9, 30},
+    {3, 2, 10, 15},
+};
+
+// The map the single tile copies and moves are done on
+static SE expected[SE_COL_LEN][SE_ROW_LEN];
+
+bool test_slide_up(Rect rect, bool move, int num_steps)
+{
+    for (int y = 0; y < SE_COL_LEN; y++)
+    {
+        for (int x = 0; x < SE_ROW_LEN; x++)
+        {
+            main_bg_se_shadow[y][x] = expected[y][x] = rand();
+        }
+    }
+
+    for (int step = 1; step <= num_steps; step++)
+    {
+        bg_se_copy_or_move_rect_1_tile_vert(expected, rect, SE_UP, move);
+        main_bg_se_slide_up_step(rect, step, move);
+
+        for (int y = 0; y < MAIN_BG_VISIBLE_ROWS; y++)
+        {
+            if (memcmp(expected[y], main_bg_se_shadow[y], sizeof(expected[y])) != 0)
+            {
+                fprintf(stderr, "Error: row %d differs after step %d of sliding {%d, %d, %d, %d} up, move %d\n",
+                        y, step, rect.left, rect.top, rect.right, rect.bottom, move);
+                return false;
+            }
+        }
+    }
+
+    main_bg_se_slide_up_finish(rect, num_steps, move);
+
+    for (int y = 0; y < SE_COL_LEN; y++)
+    {
+        if (memcmp(expected[y], main_bg_se_shadow[y], sizeof(expected[y])) != 0)
+        {
+            fprintf(stderr, "Error: row %d differs after finishing %d steps of sliding {%d, %d, %d, %d} up, move %d\n",
+                    y, num_steps, rect.left, rect.top, rect.right, rect.bottom, move);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main(void)
+{
+    srand(1);
+
+    printf("Testing Slide Up Steps Against Single Tile Copies and Moves for up to %d steps.\n", MAX_STEPS_TO_TEST);
+    for (int i = 0; i < NUM_ELEM_IN_ARR(test_rects); i++)
+    {
+        for (int num_steps = 1; num_steps <= MAX_STEPS_TO_TEST; num_steps++)
+        {
+            if (!test_slide_up(test_rects[i], false, num_steps)) return 1;
+            if (!test_slide_up(test_rects[i], true, num_steps)) return 1;
+        }
+    }
+
+    printf("---------------------------------------------------------\n");
+    printf("Main Background Slide Tests Passed\n");
+    printf("---------------------------------------------------------\n");
+
+    return 0;
+}
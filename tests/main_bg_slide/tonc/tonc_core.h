@@ -0,0 +1,55 @@
+// Just enough of libtonc for source/graphic_utils.c to build on the host.
+// VRAM and the registers are plain variables, keep the names in step with libtonc.
+#ifndef TONC_CORE_H
+#define TONC_CORE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef unsigned int uint;
+
+typedef u16 SE;
+typedef SE SCREENBLOCK[1024];
+typedef SE SCREENMAT[32][32];
+
+typedef struct { int left, top, right, bottom; } RECT;
+typedef struct { s16 x, y; } BG_POINT;
+
+#define INLINE static inline
+#define ALIGN4 __attribute__((aligned(4)))
+
+#define SCREEN_HEIGHT 160
+
+extern SCREENBLOCK host_se_mem[32];
+#define se_mem host_se_mem
+#define se_mat ((SCREENMAT *)host_se_mem)
+
+#define dma3_cpy(dst, src, size) memcpy(dst, src, size)
+
+extern u32 host_reg_dispcnt;
+extern u16 host_reg_bldcnt;
+#define REG_DISPCNT host_reg_dispcnt
+#define REG_BLDCNT host_reg_bldcnt
+#define DCNT_WIN0 0x2000
+#define DCNT_WIN1 0x4000
+#define BLD_BG1 0x0002
+#define BLD_BG2 0x0004
+#define BLD_BUILD(top, bot, mode) ((((bot) & 63) << 8) | (((mode) & 3) << 6) | ((top) & 63))
+
+void memcpy16(void *dst, const void *src, uint hwcount);
+void memset16(void *dst, u16 hw, uint hwcount);
+void memcpy32(void *dst, const void *src, uint wcount);
+void memset32(void *dst, u32 wd, uint wcount);
+
+void tte_erase_rect(int left, int top, int right, int bottom);
+
+static inline int max(int a, int b) { return a > b ? a : b; }
+static inline int min(int a, int b) { return a < b ? a : b; }
+
+#endif // TONC_CORE_H
@@ -0,0 +1 @@
+#include "tonc_core.h"
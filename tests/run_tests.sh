@@ -10,4 +10,22 @@ run_pool_test() {
     cd - > /dev/null 
 }
 
+run_affine_background_test() {
+    cd affine_background
+    make clean
+    make
+    ./build/affine_background_test
+    cd - > /dev/null
+}
+
+run_main_bg_slide_test() {
+    cd main_bg_slide
+    make clean
+    make
+    ./build/main_bg_slide_test
+    cd - > /dev/null
+}
+
 run_pool_test
+run_affine_background_test
+run_main_bg_slide_test